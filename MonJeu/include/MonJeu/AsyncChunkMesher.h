@@ -0,0 +1,102 @@
+// include/MonJeu/AsyncChunkMesher.h
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+#include "Chunk.h"
+#include "ChunkMeshCache.h"
+
+namespace MonJeu {
+
+/**
+ * @brief Pool de threads exécutant l'étape CPU du meshing (Chunk::BuildMeshData).
+ *
+ * Chaque tâche travaille sur des instantanés du chunk et de ses voisins (copies à
+ * sections partagées) : le monde peut être modifié pendant le meshing. Les résultats
+ * sont récupérés par le thread principal, seul autorisé à créer les objets OpenGL.
+ * Avec un ChunkMeshCache, un mesh déjà calculé pour les mêmes voxels est relu du disque.
+ * Les mêmes threads fusionnent les meshes de super-chunks (Chunk::MergeMeshData).
+ */
+class AsyncChunkMesher {
+public:
+    struct Job {
+        uint64_t key;
+        uint64_t ticket;                               // Identifie la demande côté appelant
+        Chunk chunk;                                   // Chunk::TakeMeshingSnapshot
+        std::array<std::optional<Chunk>, 4> neighbors; // +X, -X, +Z, -Z (vide si non chargé)
+        MeshingMode mode;
+        const ChunkMeshCache* diskCache = nullptr;     // Consulté avant le meshing, complété après (optionnel)
+        int lodScale = 1;                              // > 1 : mesh simplifié (Chunk::BuildLODMeshData)
+        std::array<int, 4> neighborScales{1, 1, 1, 1}; // Échelle du mesh affiché de chaque voisin (ChunkNeighbors)
+    };
+
+    struct Result {
+        uint64_t key;
+        uint64_t ticket;
+        Chunk chunk;        // Instantané meshé, à reprendre avec Chunk::AdoptMeshCache
+        ChunkMeshData data;
+    };
+
+    // Fusion des meshes de 2x2 chunks (données partagées, jamais modifiées après l'upload)
+    struct MergeJob {
+        uint64_t key;
+        uint64_t ticket;
+        std::array<std::shared_ptr<const ChunkMeshData>, 4> members; // Emplacements x + 2 * z
+    };
+
+    struct MergeResult {
+        uint64_t key;
+        uint64_t ticket;
+        ChunkMeshData data;
+    };
+
+    /**
+     * @param threadCount Nombre de threads de travail (0 = cœurs disponibles moins le thread principal)
+     */
+    explicit AsyncChunkMesher(unsigned int threadCount = 0);
+    ~AsyncChunkMesher();
+
+    AsyncChunkMesher(const AsyncChunkMesher&) = delete;
+    AsyncChunkMesher& operator=(const AsyncChunkMesher&) = delete;
+
+    void Submit(Job job);
+    void SubmitMerge(MergeJob job);
+
+    /**
+     * @brief Déplace les résultats terminés à la fin de results, sans bloquer.
+     * @return Nombre de résultats ajoutés
+     */
+    size_t CollectResults(std::vector<Result>& results);
+    size_t CollectMergeResults(std::vector<MergeResult>& results);
+
+    /**
+     * @brief Bloque jusqu'à ce que toutes les tâches soumises soient terminées.
+     */
+    void WaitIdle();
+
+    size_t GetThreadCount() const { return m_Threads.size(); }
+
+private:
+    void WorkerLoop();
+    void FinishJob(); // Sous m_Mutex
+
+    std::vector<std::thread> m_Threads;
+    std::mutex m_Mutex;
+    std::condition_variable m_JobAvailable;
+    std::condition_variable m_Idle;
+    std::deque<Job> m_Jobs;
+    std::vector<Result> m_Results;
+    std::deque<MergeJob> m_MergeJobs;
+    std::vector<MergeResult> m_MergeResults;
+    size_t m_ActiveJobs = 0;
+    bool m_Stopping = false;
+};
+
+} // namespace MonJeu
@@ -2,21 +2,50 @@
 #pragma once
 
 #include <vector>
+#include <array>
 #include <memory>
+#include <cstdint>
 #include <glm/glm.hpp>
 #include <NihilEngine/Mesh.h>
 #include <NihilEngine/ProceduralGenerator.h>
 #include "Constants.h"
+#include "PalettedVoxelStorage.h"
+#include "SectionOccupancy.h"
+#include "ChunkMeshBuilder.h"
 
 namespace MonJeu {
 
 // Type de bloc simple pour le jeu
-enum class BlockType { Air, Grass, Dirt, Stone };
+enum class BlockType : uint8_t { Air, Grass, Dirt, Stone };
 
-// Voxel de jeu
+// Voxel de jeu (valeur décodée depuis le stockage palettisé du chunk)
 struct Voxel {
     BlockType type = BlockType::Air;
-    bool active = false;
+
+    // Un voxel est actif (solide) dès qu'il n'est pas de l'air
+    bool IsActive() const { return type != BlockType::Air; }
+};
+
+// Stratégie de construction des meshes de chunk (sélectionnable à l'exécution)
+enum class MeshingMode {
+    PerFace, // Un quad par face visible
+    Greedy   // Faces coplanaires de même type fusionnées en rectangles maximaux
+};
+
+class Chunk;
+
+// Vues en lecture seule sur les quatre voisins horizontaux d'un chunk (nullptr si non chargé)
+struct ChunkNeighbors {
+    const Chunk* posX = nullptr;
+    const Chunk* negX = nullptr;
+    const Chunk* posZ = nullptr;
+    const Chunk* negZ = nullptr;
+
+    // Côté des cellules du mesh affiché de chaque voisin (cf. Chunk::BuildLODMeshData)
+    int posXScale = 1;
+    int negXScale = 1;
+    int posZScale = 1;
+    int negZScale = 1;
 };
 
 // Contient les meshes nécessaires pour un chunk
@@ -24,31 +53,154 @@ struct Voxel {
 struct ChunkMeshes {
     std::unique_ptr<NihilEngine::Mesh> mainMesh;
     // grassTopMeshes supprimé - herbe intégrée dans mainMesh
+
+    // Plage d'indices de chaque direction de face (+Z, -Z, -X, +X, +Y, -Y), contiguës dans mainMesh
+    std::array<NihilEngine::MeshRange, 6> faceRanges;
+
+    // Étendue verticale de la géométrie (sections non vides), pour le rejet des faces arrière
+    int minY = 0;
+    int maxY = 0;
+};
+
+// Résultat de l'étape CPU du meshing (sans objet GL) : peut être produit sur un thread de travail
+struct ChunkMeshData {
+    std::vector<uint32_t> vertices; // Quads de sommets empaquetés, directions contiguës
+    std::array<NihilEngine::MeshRange, 6> faceRanges;
+    int minY = 0;
+    int maxY = 0;
 };
 
 /**
- * @brief Représente une section 16x16x16 du monde de voxels.
+ * @brief Représente une colonne 16x256x16 du monde de voxels, découpée en sections 16³.
+ * Une section entièrement vide n'est pas allouée ; une section homogène (ex. pierre
+ * profonde) ne stocke qu'une entrée de palette.
+ * Les sections sont partagées et copiées à l'écriture : copier un Chunk (sur le thread
+ * principal) donne un instantané immuable peu coûteux, lisible depuis un autre thread.
  */
 class Chunk {
 public:
-    static const int SIZE = 16;
+    static constexpr int SIZE = ChunkShape::SIZE_X;      // Largeur d'une colonne et côté d'une section
+    static constexpr int HEIGHT = ChunkShape::SIZE_Y;    // Hauteur du monde en blocs
+    static constexpr int SECTION_COUNT = HEIGHT / SectionShape::SIZE_Y; // Sections empilées dans une colonne
+    static constexpr uint32_t MESHER_VERSION = 1;        // À incrémenter dès que les sommets produits changent
 
     Chunk(int chunkX, int chunkZ, Constants::BiomeType biome);
     ~Chunk() = default;
 
+    // La copie marque les sections des deux chunks comme partagées (voir EditSection)
+    Chunk(const Chunk& other);
+    Chunk& operator=(const Chunk& other);
+    Chunk(Chunk&&) noexcept = default;
+    Chunk& operator=(Chunk&&) noexcept = default;
+
     /**
      * @brief Remplit les données de voxel en utilisant le générateur procédural.
      */
     void GenerateTerrain(NihilEngine::ProceduralGenerator& generator);
 
     /**
-     * @brief Construit les meshes visibles pour ce chunk.
+     * @brief Construit les meshes visibles pour ce chunk (BuildMeshData puis UploadMeshData).
+     * @param neighbors Voisins chargés, utilisés pour cacher les faces de bordure partagées
+     * @param mode Mesher par face ou glouton (greedy) ; un changement de mode invalide tout le cache
+     */
+    ChunkMeshes CreateMeshes(const ChunkNeighbors& neighbors = {}, MeshingMode mode = MeshingMode::Greedy);
+
+    /**
+     * @brief Étape CPU : produit les sommets du chunk sans toucher à OpenGL.
+     * Seules les sections marquées sales sont re-meshées ; les quads des autres viennent du cache.
+     * Une section re-meshée réutilise le tampon de sa construction précédente s'il n'est plus partagé ;
+     * les sections sont ensuite assemblées (une copie) dans le ChunkMeshBuilder du thread appelant.
+     */
+    ChunkMeshData BuildMeshData(const ChunkNeighbors& neighbors, MeshingMode mode);
+
+    /**
+     * @brief Étape CPU d'un mesh simplifié pour les chunks lointains : voxels regroupés en cellules
+     * scale³ (solides si la majorité de leurs voxels l'est, avec le type du plus haut), faces fusionnées
+     * comme le mesher glouton. Le cache de sections (pleine résolution) n'est pas touché.
+     * Une face de bordure n'est cachée que par un voisin affiché à la même échelle ou plus grossière (sa cellule
+     * recouvre alors toute la face) ; face à un voisin plus fin, elle est toujours émise.
+     * @param scale Côté des cellules en blocs : 2, 4 ou 8
+     */
+    ChunkMeshData BuildLODMeshData(const ChunkNeighbors& neighbors, int scale) const;
+
+    /**
+     * @brief Étape GL (thread principal uniquement) : crée le mesh à partir des sommets produits.
+     */
+    static ChunkMeshes UploadMeshData(const ChunkMeshData& data);
+
+    /**
+     * @brief Fusionne les meshes de 2x2 chunks en un super-chunk (directions toujours contiguës).
+     * Les sommets gardent leurs coordonnées locales et reçoivent leur emplacement (SetVoxelVertexSlot).
+     * @param members Meshes par emplacement x + 2 * z (nullptr si le chunk est absent)
+     */
+    static ChunkMeshData MergeMeshData(const std::array<const ChunkMeshData*, 4>& members);
+
+    /**
+     * @brief Copie du chunk destinée à un meshing asynchrone ; les sections sales sont
+     * confiées à l'instantané et considérées propres ici jusqu'à la prochaine modification.
+     */
+    Chunk TakeMeshingSnapshot();
+
+    /**
+     * @brief Reprend le cache de meshes d'un instantané meshé par TakeMeshingSnapshot.
+     * Un seul meshing asynchrone à la fois par chunk. Si l'instantané n'a pas été meshé
+     * (mesh lu sur disque), ses sections sales le redeviennent ici.
+     */
+    void AdoptMeshCache(const Chunk& snapshot);
+
+    /**
+     * @brief Hash de tout ce dont dépend le mesh : voxels, version du mesher, mode et
+     * colonnes de bordure des voisins (clé du ChunkMeshCache sur disque).
+     */
+    uint64_t ComputeMeshHash(const ChunkNeighbors& neighbors, MeshingMode mode) const;
+
+    /**
+     * @brief Invalide le mesh en cache d'une section (ex. bloc modifié sur la bordure d'un voisin).
+     */
+    void MarkSectionDirty(int sectionY) {
+        if (sectionY >= 0 && sectionY < SECTION_COUNT) m_DirtySections |= 1u << sectionY;
+    }
+
+    /**
+     * @brief Invalide toutes les sections (ex. voisin chargé ou déchargé : toute la bordure change).
+     */
+    void MarkAllSectionsDirty();
+
+    // Accesseurs (y dans [0, HEIGHT))
+    Voxel GetVoxel(int x, int y, int z) const {
+        const Section* section = m_Sections[y / SIZE].get();
+        if (!section) return Voxel{};
+        return Voxel{static_cast<BlockType>(section->voxels.Get(GetIndex(x, y % SIZE, z)))};
+    }
+    void SetVoxel(int x, int y, int z, BlockType type);
+
+    /**
+     * @brief Test d'occupation rapide (masque binaire, sans décodage de la palette).
+     */
+    bool IsSolid(int x, int y, int z) const {
+        const Section* section = m_Sections[y / SIZE].get();
+        return section && section->occupancy.IsSolid(x, y % SIZE, z);
+    }
+
+    /**
+     * @brief Indique si la colonne (x, z) contient un bloc solide entre yMin et yMax inclus.
+     */
+    bool IsColumnSolidInRange(int x, int z, int yMin, int yMax) const;
+
+    /**
+     * @brief Remplit une section entière avec un seul type (l'air libère la section).
      */
-    ChunkMeshes CreateMeshes() const;
+    void FillSection(int sectionY, BlockType type);
 
-    // Accesseurs
-    Voxel& GetVoxel(int x, int y, int z);
-    const Voxel& GetVoxel(int x, int y, int z) const;
+    /**
+     * @brief Réduit la palette d'une section et libère la section si elle ne contient plus que de l'air.
+     */
+    void CompactSection(int sectionY);
+    void CompactSections();
+
+    const PalettedVoxelStorage* GetSection(int sectionY) const {
+        return m_Sections[sectionY] ? &m_Sections[sectionY]->voxels : nullptr;
+    }
     int GetChunkX() const { return m_ChunkX; }
     int GetChunkZ() const { return m_ChunkZ; }
     Constants::BiomeType GetBiome() const { return m_Biome; }
@@ -61,18 +213,103 @@ public:
 private:
     int m_ChunkX, m_ChunkZ;
     Constants::BiomeType m_Biome;
-    std::vector<Voxel> m_Voxels;
+    static const int SECTION_VOLUME = SectionShape::VOLUME;
+
+    // Les sections, les masques de bits et les sommets empaquetés (5 bits par axe horizontal) supposent cette forme
+    static_assert(ChunkShape::SIZE_X == ChunkShape::SIZE_Z, "Colonnes carrées uniquement");
+    static_assert(SectionShape::SIZE_X == SIZE && SectionShape::SIZE_Z == SIZE, "Sections de la largeur d'une colonne");
+    static_assert(HEIGHT % SectionShape::SIZE_Y == 0 && SECTION_COUNT < 32, "Hauteur multiple des sections, un bit par section");
+    static_assert(SIZE < 32 && HEIGHT < 512, "Coordonnées hors des champs de PackVoxelVertex");
+
+    // Section allouée : types de bloc palettisés + masques d'occupation tenus à jour par SetVoxel
+    // (partagée entre instantanés, jamais modifiée tant qu'elle l'est : voir EditSection)
+    struct Section {
+        explicit Section(BlockType fill)
+            : voxels(SECTION_VOLUME, static_cast<uint8_t>(fill)), occupancy(fill != BlockType::Air) {}
+
+        PalettedVoxelStorage voxels;
+        SectionOccupancy occupancy;
+    };
+
+    // Faces visibles d'une section, par direction (+Z, -Z, -X, +X, +Y, -Y), sur les lignes de l'axe de la face
+    using FaceMasks = std::array<SectionOccupancy::Lines, 6>;
+
+    std::array<std::shared_ptr<Section>, SECTION_COUNT> m_Sections; // nullptr = air
+
+    // Quads de la dernière construction de chaque section (plage propre dans le mesh du chunk)
+    struct SectionMesh {
+        std::vector<uint32_t> vertices;
+        std::array<uint32_t, 7> faceOffsets{}; // Début des sommets de chaque direction, puis fin
+    };
+
+    static const uint32_t ALL_SECTIONS = (1u << SECTION_COUNT) - 1;
+
+    std::array<std::shared_ptr<const SectionMesh>, SECTION_COUNT> m_SectionMeshes; // nullptr = aucune géométrie
+    uint32_t m_DirtySections = ALL_SECTIONS; // Bit par section à re-mesher
+    MeshingMode m_MeshedMode = MeshingMode::Greedy;
+
+    // Bit par section peut-être lue par un instantané : copiée avant la prochaine écriture.
+    // Tenu par le thread principal seul (use_count() n'ordonne pas les lectures des autres threads).
+    mutable uint32_t m_SharedSections = 0;
+
+    /**
+     * @brief Section modifiable : copiée d'abord si un instantané la partage (nullptr si non allouée).
+     */
+    Section* EditSection(int sectionY);
+
+    /**
+     * @brief Invalide la section d'un voxel modifié, et la section voisine s'il est sur sa face haute ou basse.
+     */
+    void MarkVoxelDirty(int y);
+
+    // Index dans une section (y local à la section)
+    int GetIndex(int x, int y, int z) const { return SectionShape::Index(x, y, z); }
+
+    /**
+     * @brief Vrai si la section est allouée et entièrement remplie d'un même bloc solide.
+     */
+    bool IsSectionUniformSolid(int sectionY) const;
+
+    /**
+     * @brief Vrai si la section ne peut produire aucune face : vide, ou pleine et entourée de sections pleines.
+     */
+    bool IsSectionHidden(int sectionY, const ChunkNeighbors& neighbors) const;
+
+    /**
+     * @brief Calcule les faces visibles d'une section à partir des masques d'occupation.
+     * Sous le monde tout est solide (jamais visible) ; au-dessus ou vers un voisin
+     * non chargé, tout est considéré vide.
+     */
+    void ComputeVisibleFaces(int sectionY, const ChunkNeighbors& neighbors, FaceMasks& faces) const;
 
-    int GetIndex(int x, int y, int z) const;
+    /**
+     * @brief Mesher par face : un quad 1x1 par bit de face visible d'une direction.
+     */
+    void BuildPerFaceMesh(int sectionY, int face, const SectionOccupancy::Lines& faceLines, ChunkMeshBuilder& builder) const;
+
+    /**
+     * @brief Mesher glouton : fusionne les faces visibles d'une direction tranche par tranche.
+     */
+    void BuildGreedyMesh(int sectionY, int face, const SectionOccupancy::Lines& faceLines, ChunkMeshBuilder& builder) const;
+
+    /**
+     * @brief Type d'une cellule scale³ du mesh simplifié (Air si moins de la moitié de ses voxels sont solides).
+     */
+    BlockType GetLODCell(int cellX, int cellY, int cellZ, int scale) const;
+
+    /**
+     * @brief Ajoute les 4 sommets empaquetés (NihilEngine::PackVoxelVertex) d'un quad de width x height faces.
+     */
+    static void AddQuad(
+        ChunkMeshBuilder& builder,
+        int face, BlockType type, const int origin[3], int width, int height
+    );
 
     /**
-     * @brief Ajoute les faces d'un voxel aux buffers de mesh appropriés.
+     * @brief Index de tuile d'atlas pour une face (0..3 = côtés, 4 = dessus, 5 = dessous).
+     * @return -1 si le type n'a pas de texture (air)
      */
-    void AddVisibleFacesToMeshes(
-        std::vector<float>& mainVertices,
-        std::vector<unsigned int>& mainIndices,
-        int x, int y, int z, BlockType type, const bool visible[6]
-    ) const;
+    static int GetAtlasTile(BlockType type, int face);
 
     /**
      * @brief Convertit un BiomeType du moteur en BiomeType du jeu.
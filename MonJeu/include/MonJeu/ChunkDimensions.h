@@ -0,0 +1,43 @@
+// include/MonJeu/ChunkDimensions.h
+#pragma once
+
+#include <NihilEngine/GridMath.h>
+
+namespace MonJeu {
+
+/**
+ * @brief Étendue d'un volume de voxels fixée à la compilation, avec son arithmétique d'index.
+ *
+ * Ordre de stockage : x d'abord, puis y, puis z (index = x + y * SX + z * SX * SY).
+ * Les tailles du jeu (ChunkShape, SectionShape) en dérivent ; le benchmark de
+ * tailles de chunk (benchmark_chunk_size.cpp) instancie d'autres formes.
+ */
+template <int SX, int SY, int SZ>
+struct ChunkDimensions {
+    static_assert(SX > 0 && SY > 0 && SZ > 0, "Dimensions de chunk nulles ou négatives");
+
+    static constexpr int SIZE_X = SX;
+    static constexpr int SIZE_Y = SY;
+    static constexpr int SIZE_Z = SZ;
+    static constexpr int AREA = SX * SZ;     // Colonnes (plan XZ)
+    static constexpr int VOLUME = SX * SY * SZ;
+
+    static constexpr int Index(int x, int y, int z) { return x + y * SX + z * SX * SY; }
+    static constexpr int ColumnIndex(int x, int z) { return x + z * SX; }
+
+    static constexpr bool Contains(int x, int y, int z) {
+        return x >= 0 && x < SX && y >= 0 && y < SY && z >= 0 && z < SZ;
+    }
+
+    /**
+     * @brief Coordonnée de chunk contenant une coordonnée monde (arrondi vers -infini).
+     */
+    static constexpr int ToChunkX(int worldX) { return NihilEngine::FloorDiv(worldX, SX); }
+    static constexpr int ToChunkZ(int worldZ) { return NihilEngine::FloorDiv(worldZ, SZ); }
+};
+
+// Forme des chunks du jeu : colonnes 16x256x16 découpées en sections 16³
+using ChunkShape = ChunkDimensions<16, 256, 16>;
+using SectionShape = ChunkDimensions<16, 16, 16>;
+
+} // namespace MonJeu
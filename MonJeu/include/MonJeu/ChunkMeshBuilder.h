@@ -0,0 +1,74 @@
+// include/MonJeu/ChunkMeshBuilder.h
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace MonJeu {
+
+/**
+ * @brief Tampon de sommets réutilisable pour la construction des meshes de chunk.
+ *
+ * La capacité est conservée d'un chunk à l'autre. Les sommets terminés sont cédés
+ * sans copie (TakeVertices) et le builder repart d'un tampon recyclé : une fois les
+ * tampons des meshes remplacés rendus par Recycle, il ne fait plus aucune allocation.
+ * Une instance par thread (GetThreadLocal).
+ */
+class ChunkMeshBuilder {
+public:
+    static const size_t DEFAULT_RESERVED_QUADS = 4096;
+    static const size_t MAX_RECYCLED_BUFFERS = 64; // Tampons rendus en attente, au-delà ils sont libérés
+
+    explicit ChunkMeshBuilder(size_t reservedQuads = DEFAULT_RESERVED_QUADS);
+
+    /**
+     * @brief Vide le tampon sans libérer sa capacité.
+     */
+    void Reset() { m_Vertices.clear(); }
+
+    /**
+     * @brief Ajoute les 4 sommets empaquetés d'un quad.
+     */
+    void PushQuad(uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3) {
+        m_Vertices.insert(m_Vertices.end(), {v0, v1, v2, v3});
+    }
+
+    /**
+     * @brief Ajoute des sommets déjà construits (ex. quads mis en cache d'une section).
+     */
+    void Append(const uint32_t* begin, const uint32_t* end) {
+        m_Vertices.insert(m_Vertices.end(), begin, end);
+    }
+
+    /**
+     * @brief Échange le tampon du builder avec un vecteur externe, sans copie : le builder
+     * construit alors directement dans ce vecteur (ex. le tampon en cache d'une section).
+     */
+    void Swap(std::vector<uint32_t>& vertices) { m_Vertices.swap(vertices); }
+
+    /**
+     * @brief Cède les sommets construits, sans copie. Le builder repart d'un tampon recyclé,
+     * ou à défaut d'un tampon neuf réservé à la taille de celui qui vient d'être cédé.
+     */
+    std::vector<uint32_t> TakeVertices();
+
+    /**
+     * @brief Rend le tampon d'un mesh dont on n'a plus besoin ; repris par le prochain TakeVertices,
+     * quel que soit le thread. Thread-safe.
+     */
+    static void Recycle(std::vector<uint32_t>&& vertices);
+
+    const std::vector<uint32_t>& GetVertices() const { return m_Vertices; }
+    size_t GetQuadCount() const { return m_Vertices.size() / 4; }
+
+    /**
+     * @brief Builder propre au thread appelant.
+     */
+    static ChunkMeshBuilder& GetThreadLocal();
+
+private:
+    std::vector<uint32_t> m_Vertices;
+};
+
+} // namespace MonJeu
@@ -0,0 +1,50 @@
+// include/MonJeu/ChunkMeshCache.h
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include "Chunk.h"
+
+namespace MonJeu {
+
+/**
+ * @brief Cache disque des meshes de chunk, à côté de la sauvegarde du monde.
+ *
+ * Un fichier par chunk garde les dernières variantes de son mesh (données prêtes à
+ * l'upload), chacune identifiée par Chunk::ComputeMeshHash : voxels, version du mesher,
+ * mode et bordures des voisins. Un chunk modifié change de hash, l'ancienne entrée
+ * finit évincée. Utilisable depuis plusieurs threads tant que les chunks diffèrent.
+ */
+class ChunkMeshCache {
+public:
+    static const uint32_t MAX_ENTRIES = 4; // Variantes gardées par chunk (voisins chargés ou non)
+
+    explicit ChunkMeshCache(const std::filesystem::path& directory);
+
+    /**
+     * @brief Lit le mesh mis en cache pour ce hash.
+     * @return false si absent (ou fichier illisible, ou entrée incohérente : voir IsValidEntry)
+     */
+    bool Load(int chunkX, int chunkZ, uint64_t hash, ChunkMeshData& data) const;
+
+    /**
+     * @brief Enregistre un mesh en tête du fichier du chunk (l'entrée la plus ancienne est évincée).
+     * Le fichier est réécrit à côté puis renommé : en cas d'échec, l'ancien reste intact.
+     */
+    bool Store(int chunkX, int chunkZ, uint64_t hash, const ChunkMeshData& data) const;
+
+private:
+    std::filesystem::path m_Directory;
+
+    std::filesystem::path GetCachePath(int chunkX, int chunkZ) const;
+    bool ReadFile(const std::filesystem::path& path, std::vector<uint8_t>& bytes) const;
+
+    /**
+     * @brief Vrai si une entrée lue décrit un mesh utilisable : quads entiers, plages de directions
+     * contiguës à partir de 0 et contenues dans les sommets, 0 <= minY <= maxY <= Chunk::HEIGHT.
+     */
+    static bool IsValidEntry(int32_t minY, int32_t maxY, const std::array<NihilEngine::MeshRange, 6>& faceRanges,
+                             uint32_t vertexCount);
+};
+
+} // namespace MonJeu
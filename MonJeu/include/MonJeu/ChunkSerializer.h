@@ -21,8 +21,8 @@ public:
         int chunkX;
         int chunkZ;
         Constants::BiomeType biome;
-        std::vector<uint8_t> voxelData; // Données compactées des voxels
-        uint32_t version = 1; // Version du format pour la compatibilité future
+        std::vector<uint8_t> voxelData; // Données compactées des voxels (disposition selon la version)
+        uint32_t version = CURRENT_VERSION; // Version du format pour la compatibilité future
     };
 
     /**
@@ -51,14 +51,31 @@ private:
     // - chunkX (int32_t)
     // - chunkZ (int32_t)
     // - biome (uint8_t)
-    // - voxelData: pour chaque voxel (16*16*16):
-    //   - type (uint8_t: 0=Air, 1=Grass, 2=Dirt, 3=Stone)
-    //   - active (uint8_t: 0=false, 1=true)
+    // - voxelData v1 (une seule section 16*16*16, lecture seule):
+    //   pour chaque voxel : type (uint8_t: 0=Air, 1=Grass, 2=Dirt, 3=Stone), active (uint8_t)
+    // - voxelData v2 (colonne de sections):
+    //   - nombre de sections (uint8_t)
+    //   - pour chaque section : tag (uint8_t)
+    //     - SECTION_EMPTY : rien (air)
+    //     - SECTION_UNIFORM : type (uint8_t)
+    //     - SECTION_FULL : un type (uint8_t) par voxel, ordre y, z, x
 
+    static constexpr uint32_t CURRENT_VERSION = 2;
     static constexpr size_t HEADER_SIZE = sizeof(uint32_t) + sizeof(int32_t) * 2 + sizeof(uint8_t);
-    static constexpr size_t VOXEL_SIZE = 2; // type + active
-    static constexpr size_t CHUNK_DATA_SIZE = Chunk::SIZE * Chunk::SIZE * Chunk::SIZE * VOXEL_SIZE;
-    static constexpr size_t TOTAL_SIZE = HEADER_SIZE + CHUNK_DATA_SIZE;
+
+    static constexpr size_t V1_VOXEL_SIZE = 2; // type + active
+    static constexpr size_t V1_CHUNK_DATA_SIZE = Chunk::SIZE * Chunk::SIZE * Chunk::SIZE * V1_VOXEL_SIZE;
+    static constexpr size_t V1_TOTAL_SIZE = HEADER_SIZE + V1_CHUNK_DATA_SIZE;
+
+    static constexpr uint8_t SECTION_EMPTY = 0;
+    static constexpr uint8_t SECTION_UNIFORM = 1;
+    static constexpr uint8_t SECTION_FULL = 2;
+    static constexpr size_t SECTION_VOLUME = Chunk::SIZE * Chunk::SIZE * Chunk::SIZE;
+
+    /**
+     * @brief Écrit les voxels désérialisés dans le chunk (v1 ou v2), puis compacte ses sections.
+     */
+    static void ReadVoxelData(Chunk& chunk, const SerializedChunk& data);
 };
 
 } // namespace MonJeu
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include "ChunkDimensions.h"
 
 namespace MonJeu {
     namespace Constants {
@@ -21,13 +22,29 @@ namespace MonJeu {
         constexpr float RAYCAST_DISTANCE = 6.0f;      // (Distance pour poser/casser blocs)
 
         // Constantes de génération du monde
-        constexpr int CHUNK_SIZE = 16;                //
-        constexpr int BASE_HEIGHT = 8;
+        constexpr int CHUNK_SIZE = ChunkShape::SIZE_X; // Voir ChunkDimensions.h
+        constexpr int SAVE_FOLDER_SIZE = 512;         // Côté d'un dossier de sauvegarde, en blocs
+        constexpr int CHUNKS_PER_SAVE_FOLDER = SAVE_FOLDER_SIZE / CHUNK_SIZE;
+        constexpr int BASE_HEIGHT = 64;               // Niveau moyen du terrain (monde de 256 blocs)
         constexpr float TERRAIN_FREQUENCY = 0.1f;
-        constexpr int TERRAIN_AMPLITUDE = 4;
+        constexpr int TERRAIN_AMPLITUDE = 32;
 
         // Constantes de rendu
         constexpr float LINE_WIDTH = 2.0f;
+        constexpr bool MESH_DISK_CACHE = true;        // Meshes des chunks sauvegardés gardés sur disque (meshcache/)
+        constexpr float SUPER_CHUNK_DISTANCE = 160.0f; // Au-delà, chunks dessinés par groupes de 2x2 (un appel)
+
+        // Meshes simplifiés des chunks lointains : cellules de 2, 4 puis 8 blocs au-delà de chaque seuil
+        constexpr float LOD_2X_DISTANCE = 128.0f;
+        constexpr float LOD_4X_DISTANCE = 224.0f;
+        constexpr float LOD_8X_DISTANCE = 320.0f;
+        constexpr float LOD_HYSTERESIS = 16.0f;       // Marge avant de changer de niveau (pas d'allers-retours)
+
+        // Horizon lointain : maillage de hauteurs tiré du bruit seul, au-delà de la distance d'affichage
+        constexpr float HORIZON_DISTANCE = 2048.0f;
+        constexpr int HORIZON_TILE_SIZE = 64;         // Blocs par tuile (multiple de Chunk::SIZE)
+        constexpr int HORIZON_SAMPLES = 4;            // Hauteurs échantillonnées par côté de tuile
+        constexpr float HORIZON_DROP = 2.0f;          // Abaissement pour rester sous le terrain voxel
 
         // Biomes (Spécifique au jeu)
         enum class BiomeType {
@@ -0,0 +1,60 @@
+// include/MonJeu/Horizon.h
+#pragma once
+
+#include <memory>
+#include <glm/glm.hpp>
+#include <NihilEngine/ChunkDataCache.h>
+#include <NihilEngine/Entity.h>
+#include <NihilEngine/ProceduralGenerator.h>
+#include "Constants.h"
+
+namespace NihilEngine {
+    class Renderer;
+    class Camera;
+}
+
+namespace MonJeu {
+
+/**
+ * @brief Horizon lointain : maillage de hauteurs grossier au-delà de la distance d'affichage des voxels.
+ *
+ * Chaque tuile de TILE_SIZE blocs est résumée (SimplifiedChunkData : hauteurs, biome dominant, couleur)
+ * par quelques évaluations du bruit, sans générer de voxels. Les résumés vivent dans le ChunkDataCache
+ * du monde ; le maillage (deux triangles par tuile) est reconstruit quand la caméra change de tuile.
+ */
+class Horizon {
+public:
+    static const int TILE_SIZE = Constants::HORIZON_TILE_SIZE;
+
+    Horizon(NihilEngine::ProceduralGenerator& generator, NihilEngine::ChunkDataCache& cache);
+
+    /**
+     * @brief Reconstruit l'anneau si la caméra a changé de tuile ou si le rayon intérieur a changé.
+     * @param innerRadius Distance d'affichage des voxels : l'horizon commence au-delà
+     * @param currentTime Horodatage des résumés utilisés (voir ChunkDataCache::cleanupOldData)
+     */
+    void Update(const glm::vec3& cameraPosition, float innerRadius, double currentTime);
+
+    void Render(NihilEngine::Renderer& renderer, const NihilEngine::Camera& camera) const;
+
+    int GetTriangleCount() const { return m_TriangleCount; }
+
+private:
+    NihilEngine::ProceduralGenerator& m_Generator;
+    NihilEngine::ChunkDataCache& m_Cache;
+
+    std::unique_ptr<NihilEngine::Entity> m_Entity;
+    int m_CenterTileX = 0;
+    int m_CenterTileZ = 0;
+    float m_InnerRadius = -1.0f; // Négatif : jamais construit
+    int m_TriangleCount = 0;
+
+    /**
+     * @brief Résumé d'une tuile, calculé au premier accès (clé : premier chunk de la tuile).
+     */
+    const NihilEngine::SimplifiedChunkData& GetTileSummary(int tileX, int tileZ, double currentTime);
+
+    void Rebuild(const glm::vec3& cameraPosition, double currentTime);
+};
+
+} // namespace MonJeu
@@ -0,0 +1,74 @@
+// include/MonJeu/PalettedVoxelStorage.h
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace MonJeu {
+
+/**
+ * @brief Stockage compressé des identifiants de bloc d'un volume de voxels.
+ *
+ * Chaque voxel stocke un index dans une palette locale, empaqueté sur
+ * 0, 1, 2, 4 ou 8 bits selon le nombre de types distincts rencontrés.
+ * Un volume uniforme (un seul type) n'alloue aucun mot de données.
+ * La palette ne fait que grandir : la largeur des indices augmente
+ * lorsqu'un nouveau type apparaît.
+ */
+class PalettedVoxelStorage {
+public:
+    explicit PalettedVoxelStorage(size_t voxelCount, uint8_t fillValue = 0);
+
+    /**
+     * @brief Lit l'identifiant de bloc stocké à l'index donné.
+     */
+    uint8_t Get(size_t index) const {
+        if (m_BitsPerEntry == 0) return m_Palette[0];
+        size_t bitIndex = index * m_BitsPerEntry;
+        uint64_t word = m_Words[bitIndex >> 6];
+        return m_Palette[(word >> (bitIndex & 63)) & m_EntryMask];
+    }
+
+    /**
+     * @brief Écrit un identifiant de bloc, en agrandissant la palette si nécessaire.
+     */
+    void Set(size_t index, uint8_t value);
+
+    /**
+     * @brief Remplit tout le volume avec une seule valeur (palette réinitialisée).
+     */
+    void Fill(uint8_t value);
+
+    /**
+     * @brief Retire de la palette les types qui ne sont plus utilisés et réduit la largeur des indices.
+     * Un volume redevenu homogène repasse à 0 bit (aucun mot de données).
+     */
+    void Compact();
+
+    size_t GetVoxelCount() const { return m_VoxelCount; }
+    int GetBitsPerEntry() const { return m_BitsPerEntry; }
+    size_t GetPaletteSize() const { return m_Palette.size(); }
+    bool IsUniform() const { return m_BitsPerEntry == 0; }
+
+    /**
+     * @brief Mémoire occupée par la palette et les données empaquetées (en octets).
+     */
+    size_t GetMemoryUsage() const;
+
+private:
+    size_t m_VoxelCount;
+    int m_BitsPerEntry = 0;
+    uint64_t m_EntryMask = 0;
+    std::vector<uint8_t> m_Palette;
+    std::vector<uint64_t> m_Words;
+
+    uint32_t GetEntry(size_t index) const;
+    void SetEntry(size_t index, uint32_t entry);
+    uint32_t FindOrAddPaletteEntry(uint8_t value);
+    void Repack(int newBitsPerEntry);
+
+    static int BitsForPaletteSize(size_t paletteSize);
+};
+
+} // namespace MonJeu
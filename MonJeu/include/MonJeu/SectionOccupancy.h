@@ -0,0 +1,59 @@
+// include/MonJeu/SectionOccupancy.h
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "ChunkDimensions.h"
+
+namespace MonJeu {
+
+/**
+ * @brief Masques d'occupation binaires (solide / air) d'une section 16³.
+ *
+ * Le même volume est gardé sous trois orientations, une ligne de 16 voxels par uint16_t :
+ * - axe X : index y + z * 16, bit x
+ * - axe Y : index x + z * 16, bit y (colonnes)
+ * - axe Z : index x + y * 16, bit z
+ * Les faces visibles d'une direction s'obtiennent alors par décalage et AND-NOT
+ * sur les 256 lignes d'un axe (SSE2 ou AVX2 selon la compilation, sinon scalaire).
+ */
+class SectionOccupancy {
+public:
+    static const int SIZE = SectionShape::SIZE_X;
+    static const int LINE_COUNT = SIZE * SIZE;
+    static_assert(SectionShape::SIZE_Y == SIZE && SectionShape::SIZE_Z == SIZE, "Les masques supposent une section cubique");
+    static_assert(SIZE == 16, "Une ligne de voxels tient dans un uint16_t");
+    using Lines = std::array<uint16_t, LINE_COUNT>;
+
+    explicit SectionOccupancy(bool solid = false) { Fill(solid); }
+
+    void Fill(bool solid);
+    void Set(int x, int y, int z, bool solid);
+
+    bool IsSolid(int x, int y, int z) const { return (m_Lines[1][x + z * SIZE] >> y) & 1u; }
+    uint16_t GetColumn(int x, int z) const { return m_Lines[1][x + z * SIZE]; }
+
+    /**
+     * @brief Lignes le long d'un axe (0 = X, 1 = Y, 2 = Z).
+     */
+    const Lines& GetLines(int axis) const { return m_Lines[axis]; }
+
+    /**
+     * @brief Calcule les faces visibles d'une direction : bit posé si le voxel est solide
+     * et son voisin dans le sens de la normale est vide.
+     * @param lines Lignes de la section le long de l'axe de la face
+     * @param neighbor Lignes (même axe) de la section adjacente dans le sens de la normale
+     * @param positive Normale dans le sens croissant de l'axe
+     * @param faces Masques de sortie, même disposition que lines
+     */
+    static void ExtractFaces(const Lines& lines, const Lines& neighbor, bool positive, Lines& faces);
+
+    // Lignes de référence pour une section adjacente absente (air) ou pleine
+    static const Lines& EmptyLines();
+    static const Lines& FullLines();
+
+private:
+    std::array<Lines, 3> m_Lines;
+};
+
+} // namespace MonJeu
@@ -2,15 +2,21 @@
 #pragma once
 
 #include <vector>
+#include <array>
 #include <unordered_map>
+#include <unordered_set>
 #include <glm/glm.hpp>
 #include <NihilEngine/ProceduralGenerator.h>
 #include <NihilEngine/Entity.h>
 #include <NihilEngine/Physics.h>
 #include <NihilEngine/ChunkDataCache.h>
 #include <NihilEngine/ProgressiveChunkUpdate.h>
+#include <NihilEngine/Performance.h>
 #include <memory>
 #include "Chunk.h" // Utilise le nouveau header Chunk
+#include "AsyncChunkMesher.h"
+#include "ChunkMeshCache.h"
+#include "Horizon.h"
 #include "WorldSaveManager.h" // Gestionnaire de sauvegarde
 
 #ifdef _WIN32
@@ -57,6 +63,18 @@ public:
      */
     void GenerateSpawnArea(const glm::vec3& position, int radiusChunks = 3);
 
+    /**
+     * @brief Change le mesher des chunks et reconstruit tous les meshes chargés (comparaison A/B).
+     */
+    void SetMeshingMode(MeshingMode mode);
+    MeshingMode GetMeshingMode() const { return m_MeshingMode; }
+
+    /**
+     * @brief Distance (en blocs) au-delà de laquelle les chunks sont dessinés par super-chunks 2x2.
+     */
+    void SetSuperChunkDistance(float distance) { m_SuperChunkDistance = distance; }
+    float GetSuperChunkDistance() const { return m_SuperChunkDistance; }
+
     // --- Accesseurs ---
     NihilEngine::ProceduralGenerator& GetProceduralGenerator() { return m_ProceduralGen; }
     int GetChunkCount() const { return m_Chunks.size(); }
@@ -67,24 +85,152 @@ private:
     std::unordered_map<uint64_t, std::unique_ptr<Chunk>> m_Chunks;
     std::unordered_map<uint64_t, std::unique_ptr<NihilEngine::Entity>> m_ChunkEntities;
     // std::vector<std::unordered_map<uint64_t, std::unique_ptr<NihilEngine::Entity>>> m_GrassTopEntities; - COMMENTE: suppression du système d'entités d'herbe
-    std::vector<uint64_t> m_DirtyChunks;
+
+    // Dernier mesh uploadé de chaque chunk : plages par direction de face et étendue verticale
+    // (rejet des faces arrière), sommets gardés pour la fusion en super-chunks
+    // (tampon rendu aux builders quand le mesh est remplacé ou déchargé, voir RecycleMeshData)
+    std::unordered_map<uint64_t, std::shared_ptr<ChunkMeshData>> m_ChunkMeshData;
+
+    // Super-chunk : meshes de 2x2 chunks fusionnés, dessinés en un appel au-delà de m_SuperChunkDistance.
+    // Tant que la fusion n'est pas à jour, ses chunks sont dessinés séparément.
+    struct SuperChunk {
+        std::unique_ptr<NihilEngine::Entity> entity;
+        std::array<NihilEngine::MeshRange, 6> faceRanges;
+        int minY = 0;
+        int maxY = 0;
+        uint8_t members = 0;        // Emplacements (bit x + 2 * z) présents dans le mesh fusionné
+        uint8_t pendingMembers = 0; // Emplacements de la fusion en cours
+        uint64_t pendingTicket = 0; // Fusion en cours (0 = aucune)
+        bool upToDate = false;
+        bool drawnMerged = false;   // Image courante : ses membres ne sont pas redessinés
+    };
+    std::unordered_map<uint64_t, SuperChunk> m_SuperChunks;
+    std::unordered_set<uint64_t> m_DirtySuperChunks;
+    std::vector<AsyncChunkMesher::MergeResult> m_MergeResults;
+    float m_SuperChunkDistance = Constants::SUPER_CHUNK_DISTANCE;
+
+    std::vector<uint64_t> m_DirtyChunks;   // Modifiés par le joueur : remesh + sauvegarde
+    std::vector<uint64_t> m_RemeshChunks;  // Bordure à recalculer (voisin chargé/déchargé) : remesh seul
     GLuint m_TextureAtlasID = 0;
 
     // Systèmes Moteur
     NihilEngine::ProceduralGenerator m_ProceduralGen;
     NihilEngine::ChunkDataCache m_ChunkDataCache;
     NihilEngine::ProgressiveChunkUpdate m_ProgressiveUpdate;
+    Horizon m_Horizon; // Résumés lointains dans m_ChunkDataCache
+    double m_WorldTime = 0.0; // Secondes écoulées, horodatage du cache de résumés
     NihilEngine::PhysicsWorld* m_PhysicsWorld; // Référence au monde physique
 
     // Distance d'affichage
     float m_DisplayDistance;
 
+    // Mesher utilisé pour les chunks
+    MeshingMode m_MeshingMode = MeshingMode::Greedy;
+
+    // Niveau de détail de chaque chunk (index de niveau du LODManager, 0 = pleine résolution)
+    NihilEngine::LODManager m_ChunkLOD;
+    std::unordered_map<uint64_t, int> m_ChunkLODLevels;
+    glm::vec3 m_LODCameraPosition{0.0f};
+
     // Système de sauvegarde
     WorldSaveManager* m_SaveManager;
 
+    // Cache disque des meshes (nullptr sans sauvegarde), limité aux chunks présents dans la sauvegarde :
+    // un chunk seulement généré est recalculé à chaque visite, son mesh aussi
+    std::unique_ptr<ChunkMeshCache> m_MeshCache;
+    std::unordered_set<uint64_t> m_SavedChunks;
+
+    // Meshing asynchrone : étape CPU sur les threads de travail, upload GL sur le thread principal
+    std::unordered_map<uint64_t, uint64_t> m_MeshJobs;  // Chunk -> ticket du meshing en cours
+    std::unordered_set<uint64_t> m_RemeshAfterJob;      // Modifiés pendant leur meshing : à relancer
+    std::vector<AsyncChunkMesher::Result> m_MeshResults;
+    uint64_t m_NextMeshTicket = 1;
+    AsyncChunkMesher m_Mesher; // Déclaré en dernier : ses threads s'arrêtent avant le reste
+
     // Logique interne
     void GenerateChunk(int chunkX, int chunkZ);
 
+    /**
+     * @brief Reconstruit immédiatement, sur ce thread, le mesh d'un chunk chargé en tenant compte de ses voisins.
+     * @return Nombre d'indices du nouveau mesh (0 si le chunk n'est pas chargé)
+     */
+    size_t RebuildChunkMesh(uint64_t key);
+
+    /**
+     * @brief Soumet le meshing d'un chunk aux threads de travail (instantanés du chunk et de ses voisins).
+     */
+    void RequestChunkMesh(uint64_t key);
+
+    /**
+     * @brief Crée les meshes GL des résultats terminés et les affecte aux entités.
+     */
+    void ApplyMeshResults();
+
+    /**
+     * @brief Attend et applique tous les meshings en cours (spawn, changement de mesher).
+     */
+    void FinishMeshJobs();
+
+    /**
+     * @brief Uploade un mesh et l'affecte à l'entité du chunk, créée au premier mesh.
+     */
+    void ApplyChunkMeshes(uint64_t key, std::shared_ptr<ChunkMeshData> data);
+
+    /**
+     * @brief Rend le tampon de sommets d'un mesh abandonné aux builders (ChunkMeshBuilder::Recycle),
+     * sauf si une fusion de super-chunk le lit encore.
+     */
+    static void RecycleMeshData(std::shared_ptr<ChunkMeshData> data);
+
+    /**
+     * @brief Lance la fusion des super-chunks modifiés qui sont assez loin pour être dessinés fusionnés.
+     */
+    void UpdateSuperChunks(const glm::vec3& cameraPosition);
+
+    /**
+     * @brief Vrai si le groupe 2x2 est dessiné fusionné : au-delà de m_SuperChunkDistance à l'horizontale
+     * (quelle que soit l'altitude de la caméra) et dans la distance d'affichage.
+     */
+    bool IsInSuperChunkRing(int groupX, int groupZ, const glm::vec3& cameraPosition) const;
+
+    /**
+     * @brief Remplace le mesh d'un super-chunk par une fusion terminée (si elle est toujours à jour).
+     */
+    void ApplyMergeResults();
+
+    std::unique_ptr<NihilEngine::Entity> CreateChunkEntity(NihilEngine::Mesh&& mesh, const glm::vec3& position) const;
+
+    /**
+     * @brief Niveau de détail d'un chunk vu depuis m_LODCameraPosition, avec hystérésis autour du niveau actuel.
+     */
+    int ComputeChunkLODLevel(int chunkX, int chunkZ, int currentLevel) const;
+
+    /**
+     * @brief Côté des cellules du mesh d'un chunk (1 = pleine résolution).
+     */
+    int GetChunkLODScale(uint64_t key) const;
+
+    void MarkSuperChunkDirty(int chunkX, int chunkZ);
+    uint64_t GetSuperChunkKey(int chunkX, int chunkZ) const;
+
+    const Chunk* FindChunk(int chunkX, int chunkZ) const;
+    /**
+     * @brief Voisins d'un chunk meshé à l'échelle scale, avec l'échelle de leur mesh affiché.
+     * À pleine résolution, un voisin affiché plus grossièrement est omis : ses voxels ne sont pas ce qui est
+     * dessiné, les faces de bordure restent visibles.
+     */
+    ChunkNeighbors GetNeighbors(int chunkX, int chunkZ, int scale) const;
+
+    /**
+     * @brief Planifie le remesh des voisins chargés d'un chunk dont la présence vient de changer.
+     */
+    void QueueNeighborRemesh(int chunkX, int chunkZ);
+
+    /**
+     * @brief Planifie le remesh d'une seule section d'un voisin chargé (bloc modifié sur la bordure).
+     */
+    void QueueNeighborSectionRemesh(int chunkX, int chunkZ, int sectionY);
+
     uint64_t GetChunkKey(int chunkX, int chunkZ) const;
 };
 
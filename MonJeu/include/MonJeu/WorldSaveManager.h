@@ -64,6 +64,11 @@ public:
      */
     std::filesystem::path GetWorldPath() const { return m_WorldPath; }
 
+    /**
+     * @brief Obtient le dossier du cache de meshes (ChunkMeshCache), à l'intérieur du monde
+     */
+    std::filesystem::path GetMeshCachePath() const { return m_WorldPath / "meshcache"; }
+
     /**
      * @brief Crée le dossier du monde s'il n'existe pas
      */
@@ -0,0 +1,141 @@
+// src/AsyncChunkMesher.cpp
+#include <MonJeu/AsyncChunkMesher.h>
+#include <algorithm>
+#include <iterator>
+
+namespace MonJeu {
+
+AsyncChunkMesher::AsyncChunkMesher(unsigned int threadCount) {
+    if (threadCount == 0) {
+        unsigned int cores = std::thread::hardware_concurrency();
+        threadCount = std::max(cores, 2u) - 1;
+    }
+
+    m_Threads.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        m_Threads.emplace_back(&AsyncChunkMesher::WorkerLoop, this);
+    }
+}
+
+AsyncChunkMesher::~AsyncChunkMesher() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_JobAvailable.notify_all();
+
+    for (std::thread& thread : m_Threads) {
+        thread.join();
+    }
+}
+
+void AsyncChunkMesher::Submit(Job job) {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Jobs.push_back(std::move(job));
+    }
+    m_JobAvailable.notify_one();
+}
+
+void AsyncChunkMesher::SubmitMerge(MergeJob job) {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_MergeJobs.push_back(std::move(job));
+    }
+    m_JobAvailable.notify_one();
+}
+
+size_t AsyncChunkMesher::CollectResults(std::vector<Result>& results) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    size_t count = m_Results.size();
+    std::move(m_Results.begin(), m_Results.end(), std::back_inserter(results));
+    m_Results.clear();
+    return count;
+}
+
+size_t AsyncChunkMesher::CollectMergeResults(std::vector<MergeResult>& results) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    size_t count = m_MergeResults.size();
+    std::move(m_MergeResults.begin(), m_MergeResults.end(), std::back_inserter(results));
+    m_MergeResults.clear();
+    return count;
+}
+
+void AsyncChunkMesher::WaitIdle() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_Idle.wait(lock, [this] { return m_Jobs.empty() && m_MergeJobs.empty() && m_ActiveJobs == 0; });
+}
+
+void AsyncChunkMesher::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+
+    for (;;) {
+        m_JobAvailable.wait(lock, [this] { return m_Stopping || !m_Jobs.empty() || !m_MergeJobs.empty(); });
+        if (m_Stopping) return; // Les tâches restantes sont abandonnées
+
+        // Les chunks proches passent avant les fusions de super-chunks lointains
+        if (m_Jobs.empty()) {
+            MergeJob job = std::move(m_MergeJobs.front());
+            m_MergeJobs.pop_front();
+            ++m_ActiveJobs;
+            lock.unlock();
+
+            std::array<const ChunkMeshData*, 4> members;
+            for (size_t slot = 0; slot < members.size(); ++slot) {
+                members[slot] = job.members[slot].get();
+            }
+            ChunkMeshData data = Chunk::MergeMeshData(members);
+
+            lock.lock();
+            m_MergeResults.push_back(MergeResult{job.key, job.ticket, std::move(data)});
+            FinishJob();
+            continue;
+        }
+
+        Job job = std::move(m_Jobs.front());
+        m_Jobs.pop_front();
+        ++m_ActiveJobs;
+        lock.unlock();
+
+        ChunkNeighbors neighbors;
+        neighbors.posX = job.neighbors[0] ? &*job.neighbors[0] : nullptr;
+        neighbors.negX = job.neighbors[1] ? &*job.neighbors[1] : nullptr;
+        neighbors.posZ = job.neighbors[2] ? &*job.neighbors[2] : nullptr;
+        neighbors.negZ = job.neighbors[3] ? &*job.neighbors[3] : nullptr;
+        neighbors.posXScale = job.neighborScales[0];
+        neighbors.negXScale = job.neighborScales[1];
+        neighbors.posZScale = job.neighborScales[2];
+        neighbors.negZScale = job.neighborScales[3];
+
+        ChunkMeshData data;
+        if (job.lodScale > 1) {
+            data = job.chunk.BuildLODMeshData(neighbors, job.lodScale);
+        } else {
+            bool cached = false;
+            uint64_t hash = 0;
+            int chunkX = job.chunk.GetChunkX();
+            int chunkZ = job.chunk.GetChunkZ();
+            if (job.diskCache) {
+                hash = job.chunk.ComputeMeshHash(neighbors, job.mode);
+                cached = job.diskCache->Load(chunkX, chunkZ, hash, data);
+            }
+            if (!cached) {
+                data = job.chunk.BuildMeshData(neighbors, job.mode);
+                if (job.diskCache) job.diskCache->Store(chunkX, chunkZ, hash, data);
+            }
+        }
+
+        lock.lock();
+        m_Results.push_back(Result{job.key, job.ticket, std::move(job.chunk), std::move(data)});
+        FinishJob();
+    }
+}
+
+void AsyncChunkMesher::FinishJob() {
+    --m_ActiveJobs;
+    if (m_Jobs.empty() && m_MergeJobs.empty() && m_ActiveJobs == 0) {
+        m_Idle.notify_all();
+    }
+}
+
+} // namespace MonJeu
@@ -1,47 +1,265 @@
 // src/Chunk.cpp
 #include <MonJeu/Chunk.h>
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace MonJeu {
 
 Chunk::Chunk(int chunkX, int chunkZ, Constants::BiomeType biome)
-    : m_ChunkX(chunkX), m_ChunkZ(chunkZ), m_Biome(biome), m_Voxels(SIZE * SIZE * SIZE) {}
+    : m_ChunkX(chunkX), m_ChunkZ(chunkZ), m_Biome(biome) {}
+
+Chunk::Chunk(const Chunk& other)
+    : m_ChunkX(other.m_ChunkX), m_ChunkZ(other.m_ChunkZ), m_Biome(other.m_Biome),
+      m_Sections(other.m_Sections), m_SectionMeshes(other.m_SectionMeshes),
+      m_DirtySections(other.m_DirtySections), m_MeshedMode(other.m_MeshedMode),
+      m_SharedSections(ALL_SECTIONS) {
+    other.m_SharedSections = ALL_SECTIONS;
+}
+
+Chunk& Chunk::operator=(const Chunk& other) {
+    if (this != &other) {
+        m_ChunkX = other.m_ChunkX;
+        m_ChunkZ = other.m_ChunkZ;
+        m_Biome = other.m_Biome;
+        m_Sections = other.m_Sections;
+        m_SectionMeshes = other.m_SectionMeshes;
+        m_DirtySections = other.m_DirtySections;
+        m_MeshedMode = other.m_MeshedMode;
+        m_SharedSections = ALL_SECTIONS;
+        other.m_SharedSections = ALL_SECTIONS;
+    }
+    return *this;
+}
 
 // Logique de génération de terrain (extraite de VoxelWorld.cpp)
 void Chunk::GenerateTerrain(NihilEngine::ProceduralGenerator& generator) {
-    NihilEngine::TerrainGenerator& terrainGen = generator.getTerrainGenerator();
-    NihilEngine::BiomeGenerator& biomeGen = generator.getBiomeGenerator();
+    // Hauteurs et biomes de toutes les colonnes, lus dans les tuiles partagées (une tuile couvre 4x4 chunks)
+    std::array<float, SIZE * SIZE> terrainHeights;
+    std::array<NihilEngine::BiomeType, SIZE * SIZE> biomes;
+    generator.getTileCache().getRegion(terrainHeights.data(), SIZE, biomes.data(), SIZE,
+                                       m_ChunkX * SIZE, m_ChunkZ * SIZE, SIZE, SIZE);
+
+    // Biome du chunk : celui de la dernière colonne, comme le parcours colonne par colonne précédent
+    m_Biome = convertBiomeType(biomes[(SIZE - 1) + (SIZE - 1) * SIZE]);
+
+    std::array<int, SIZE * SIZE> heights;
+    int minHeight = HEIGHT;
+    for (size_t i = 0; i < heights.size(); ++i) {
+        heights[i] = static_cast<int>(terrainHeights[i]);
+        minHeight = std::min(minHeight, heights[i]);
+    }
 
+    // Sections entièrement sous la couche de terre : pierre uniforme, sans écriture voxel par voxel
+    int stoneSections = std::clamp((minHeight - 3) / SIZE, 0, SECTION_COUNT);
+    for (int sectionY = 0; sectionY < stoneSections; ++sectionY) {
+        FillSection(sectionY, BlockType::Stone);
+    }
+
+    // Les sections au-dessus restent non allouées (air) : seuls les blocs solides sont écrits
     for (int x = 0; x < SIZE; ++x) {
         for (int z = 0; z < SIZE; ++z) {
-            int worldX = m_ChunkX * SIZE + x;
-            int worldZ = m_ChunkZ * SIZE + z;
-
-            float terrainHeight = terrainGen.getHeight(static_cast<float>(worldX), static_cast<float>(worldZ));
-            int height = static_cast<int>(terrainHeight);
-
-            NihilEngine::BiomeType biome = biomeGen.getBiome(static_cast<float>(worldX), static_cast<float>(worldZ), terrainHeight);
-            m_Biome = convertBiomeType(biome);
-
-            for (int y = 0; y < SIZE; ++y) {
-                Voxel& voxel = GetVoxel(x, y, z);
+            int height = heights[x + z * SIZE];
+            int top = std::min(height, HEIGHT - 1);
+            for (int y = stoneSections * SIZE; y <= top; ++y) {
                 if (y < height - 3) {
-                    voxel.type = BlockType::Stone;
-                    voxel.active = true;
+                    SetVoxel(x, y, z, BlockType::Stone);
                 } else if (y < height) {
-                    voxel.type = BlockType::Dirt;
-                    voxel.active = true;
-                } else if (y == height) {
-                    voxel.type = BlockType::Grass;
-                    voxel.active = true;
+                    SetVoxel(x, y, z, BlockType::Dirt);
                 } else {
-                    voxel.type = BlockType::Air;
-                    voxel.active = false;
+                    SetVoxel(x, y, z, BlockType::Grass);
+                }
+            }
+        }
+    }
+
+    CompactSections();
+}
+
+Chunk::Section* Chunk::EditSection(int sectionY) {
+    std::shared_ptr<Section>& section = m_Sections[sectionY];
+    uint32_t bit = 1u << sectionY;
+    if (section && (m_SharedSections & bit)) {
+        section = std::make_shared<Section>(*section);
+    }
+    m_SharedSections &= ~bit;
+    return section.get();
+}
+
+void Chunk::SetVoxel(int x, int y, int z, BlockType type) {
+    Section* section = EditSection(y / SIZE);
+    if (!section) {
+        if (type == BlockType::Air) return;
+        m_Sections[y / SIZE] = std::make_shared<Section>(BlockType::Air);
+        section = m_Sections[y / SIZE].get();
+    }
+    section->voxels.Set(GetIndex(x, y % SIZE, z), static_cast<uint8_t>(type));
+    section->occupancy.Set(x, y % SIZE, z, type != BlockType::Air);
+    MarkVoxelDirty(y);
+}
+
+void Chunk::MarkVoxelDirty(int y) {
+    int sectionY = y / SIZE;
+    MarkSectionDirty(sectionY);
+    if (y % SIZE == 0) MarkSectionDirty(sectionY - 1);
+    if (y % SIZE == SIZE - 1) MarkSectionDirty(sectionY + 1);
+}
+
+void Chunk::MarkAllSectionsDirty() {
+    m_DirtySections = ALL_SECTIONS;
+}
+
+Chunk Chunk::TakeMeshingSnapshot() {
+    Chunk snapshot(*this);
+    // Les sections sales seront reconstruites par l'instantané puis reprises par AdoptMeshCache :
+    // l'instantané devient seul propriétaire de leurs anciens quads et peut réutiliser leurs tampons
+    for (int sectionY = 0; sectionY < SECTION_COUNT; ++sectionY) {
+        if (m_DirtySections & (1u << sectionY)) m_SectionMeshes[sectionY].reset();
+    }
+    m_DirtySections = 0;
+    return snapshot;
+}
+
+void Chunk::AdoptMeshCache(const Chunk& snapshot) {
+    // Les sections modifiées depuis l'instantané restent marquées sales
+    m_SectionMeshes = snapshot.m_SectionMeshes;
+    m_MeshedMode = snapshot.m_MeshedMode;
+    // Mesh lu depuis le cache disque : les sections n'ont pas été reconstruites
+    m_DirtySections |= snapshot.m_DirtySections;
+}
+
+void Chunk::FillSection(int sectionY, BlockType type) {
+    MarkSectionDirty(sectionY - 1);
+    MarkSectionDirty(sectionY);
+    MarkSectionDirty(sectionY + 1);
+
+    if (type == BlockType::Air) {
+        m_Sections[sectionY].reset();
+        return;
+    }
+    Section* section = EditSection(sectionY);
+    if (!section) {
+        m_Sections[sectionY] = std::make_shared<Section>(type);
+    } else {
+        section->voxels.Fill(static_cast<uint8_t>(type));
+        section->occupancy.Fill(true);
+    }
+}
+
+void Chunk::CompactSection(int sectionY) {
+    Section* section = EditSection(sectionY);
+    if (!section) return;
+
+    section->voxels.Compact();
+    if (section->voxels.IsUniform() && section->voxels.Get(0) == static_cast<uint8_t>(BlockType::Air)) {
+        m_Sections[sectionY].reset();
+    }
+}
+
+void Chunk::CompactSections() {
+    for (int sectionY = 0; sectionY < SECTION_COUNT; ++sectionY) {
+        CompactSection(sectionY);
+    }
+}
+
+namespace {
+    // Mélange de splitmix64 : chaque mot de 64 bits modifie tout le hash
+    inline uint64_t MixHash(uint64_t hash, uint64_t value) {
+        uint64_t z = hash ^ (value + 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+}
+
+uint64_t Chunk::ComputeMeshHash(const ChunkNeighbors& neighbors, MeshingMode mode) const {
+    uint64_t hash = MixHash(MESHER_VERSION, static_cast<uint64_t>(mode));
+
+    // Voxels : les types suffisent (l'occupation en découle)
+    for (const auto& section : m_Sections) {
+        if (!section) {
+            hash = MixHash(hash, 0);
+            continue;
+        }
+        const PalettedVoxelStorage& voxels = section->voxels;
+        if (voxels.IsUniform()) {
+            hash = MixHash(hash, 0x100u | voxels.Get(0));
+            continue;
+        }
+        for (int i = 0; i < SECTION_VOLUME; i += 8) {
+            uint64_t packed = 0;
+            for (int j = 0; j < 8; ++j) {
+                packed |= static_cast<uint64_t>(voxels.Get(i + j)) << (j * 8);
+            }
+            hash = MixHash(hash, packed);
+        }
+    }
+
+    // Voisins : seules leurs colonnes de bordure touchent nos faces
+    auto mixBorder = [&hash](const Chunk* neighbor, int x0, int z0, int dx, int dz) {
+        if (!neighbor) {
+            hash = MixHash(hash, ~0ull);
+            return;
+        }
+        for (const auto& section : neighbor->m_Sections) {
+            if (!section) {
+                hash = MixHash(hash, 0);
+                continue;
+            }
+            for (int i = 0; i < SIZE; i += 4) {
+                uint64_t packed = 0;
+                for (int j = 0; j < 4; ++j) {
+                    int step = i + j;
+                    packed |= static_cast<uint64_t>(section->occupancy.GetColumn(x0 + dx * step, z0 + dz * step)) << (j * 16);
                 }
+                hash = MixHash(hash, packed);
             }
         }
+    };
+    mixBorder(neighbors.posX, 0, 0, 0, 1);
+    mixBorder(neighbors.negX, SIZE - 1, 0, 0, 1);
+    mixBorder(neighbors.posZ, 0, 0, 1, 0);
+    mixBorder(neighbors.negZ, 0, SIZE - 1, 1, 0);
+    return hash;
+}
+
+bool Chunk::IsColumnSolidInRange(int x, int z, int yMin, int yMax) const {
+    yMin = std::max(yMin, 0);
+    yMax = std::min(yMax, HEIGHT - 1);
+
+    for (int sectionY = yMin / SIZE; yMin <= yMax && sectionY <= yMax / SIZE; ++sectionY) {
+        const Section* section = m_Sections[sectionY].get();
+        if (!section) continue;
+
+        int low = std::max(yMin - sectionY * SIZE, 0);
+        int high = std::min(yMax - sectionY * SIZE, SIZE - 1);
+        uint32_t range = ((1u << (high + 1)) - 1u) & ~((1u << low) - 1u);
+        if (section->occupancy.GetColumn(x, z) & range) return true;
     }
+    return false;
+}
+
+bool Chunk::IsSectionUniformSolid(int sectionY) const {
+    const Section* section = m_Sections[sectionY].get();
+    return section && section->voxels.IsUniform() && section->voxels.Get(0) != static_cast<uint8_t>(BlockType::Air);
+}
+
+bool Chunk::IsSectionHidden(int sectionY, const ChunkNeighbors& neighbors) const {
+    if (!m_Sections[sectionY]) return true;
+    if (!IsSectionUniformSolid(sectionY)) return false;
+
+    // Section pleine : des faces n'existent que contre une section adjacente non pleine
+    auto isSolid = [sectionY](const Chunk* chunk) { return chunk && chunk->IsSectionUniformSolid(sectionY); };
+    bool belowSolid = sectionY == 0 || IsSectionUniformSolid(sectionY - 1);
+    bool aboveSolid = sectionY + 1 < SECTION_COUNT && IsSectionUniformSolid(sectionY + 1);
+    return belowSolid && aboveSolid &&
+           isSolid(neighbors.posX) && isSolid(neighbors.negX) &&
+           isSolid(neighbors.posZ) && isSolid(neighbors.negZ);
 }
 
 Constants::BiomeType Chunk::convertBiomeType(NihilEngine::BiomeType engineBiome) {
@@ -55,191 +273,502 @@ Constants::BiomeType Chunk::convertBiomeType(NihilEngine::BiomeType engineBiome)
     }
 }
 
+namespace {
+    // Géométrie d'une direction de face, dans l'ordre des faces : +Z, -Z, -X, +X, +Y, -Y
+    struct FaceAxes {
+        int d;              // Axe normal à la face (0 = X, 1 = Y, 2 = Z)
+        int u, v;           // Axes du plan de la face
+        int sign;           // Sens de la normale le long de d
+        int corners[4][2];  // Coins (u, v) dans l'ordre d'émission des sommets
+    };
+
+    constexpr FaceAxes FACE_AXES[6] = {
+        {2, 0, 1, +1, {{0, 0}, {1, 0}, {1, 1}, {0, 1}}}, // +Z
+        {2, 0, 1, -1, {{1, 0}, {0, 0}, {0, 1}, {1, 1}}}, // -Z
+        {0, 2, 1, -1, {{1, 0}, {0, 0}, {0, 1}, {1, 1}}}, // -X
+        {0, 2, 1, +1, {{0, 0}, {1, 0}, {1, 1}, {0, 1}}}, // +X
+        {1, 0, 2, +1, {{0, 1}, {1, 1}, {1, 0}, {0, 0}}}, // +Y
+        {1, 0, 2, -1, {{0, 0}, {1, 0}, {1, 1}, {0, 1}}}  // -Y
+    };
+
+    // Ligne d'un voxel (coordonnées locales à la section) dans les masques d'occupation d'un axe
+    inline int LineIndex(int axis, const int pos[3]) {
+        switch (axis) {
+            case 0:  return pos[1] + pos[2] * SectionOccupancy::SIZE;
+            case 1:  return pos[0] + pos[2] * SectionOccupancy::SIZE;
+            default: return pos[0] + pos[1] * SectionOccupancy::SIZE;
+        }
+    }
+
+    // Inverse de LineIndex : position locale du bit d'une ligne
+    inline void LinePosition(int axis, int line, int bit, int pos[3]) {
+        int low = line % SectionOccupancy::SIZE;
+        int high = line / SectionOccupancy::SIZE;
+        switch (axis) {
+            case 0:  pos[0] = bit; pos[1] = low; pos[2] = high; break;
+            case 1:  pos[0] = low; pos[1] = bit; pos[2] = high; break;
+            default: pos[0] = low; pos[1] = high; pos[2] = bit; break;
+        }
+    }
+
+    inline int CountTrailingZeros(uint32_t value) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, value);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctz(value);
+#endif
+    }
+
+    inline int CountLeadingZeros(uint32_t value) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse(&index, value);
+        return 31 - static_cast<int>(index);
+#else
+        return __builtin_clz(value);
+#endif
+    }
+
+    // Format de sommet des chunks : un uint32 empaqueté (position locale, face, tuile)
+    const std::vector<NihilEngine::VertexAttribute> CHUNK_VERTEX_ATTRIBUTES = {
+        NihilEngine::VertexAttribute::PackedVoxel
+    };
+}
+
 // Logique de création de mesh (extraite de VoxelWorld.cpp)
-ChunkMeshes Chunk::CreateMeshes() const {
-    std::vector<float> mainVertices;
-    std::vector<unsigned int> mainIndices;
+ChunkMeshes Chunk::CreateMeshes(const ChunkNeighbors& neighbors, MeshingMode mode) {
+    return UploadMeshData(BuildMeshData(neighbors, mode));
+}
+
+ChunkMeshes Chunk::UploadMeshData(const ChunkMeshData& data) {
+    ChunkMeshes meshes;
+    meshes.mainMesh = std::make_unique<NihilEngine::Mesh>(data.vertices, CHUNK_VERTEX_ATTRIBUTES);
+    meshes.faceRanges = data.faceRanges;
+    meshes.minY = data.minY;
+    meshes.maxY = data.maxY;
+    // grassTopMeshes supprimé - herbe intégrée dans mainMesh
+    return meshes;
+}
+
+ChunkMeshData Chunk::MergeMeshData(const std::array<const ChunkMeshData*, 4>& members) {
+    ChunkMeshData merged;
+    size_t vertexCount = 0;
+    for (const ChunkMeshData* member : members) {
+        if (!member || member->vertices.empty()) continue;
+        merged.minY = vertexCount == 0 ? member->minY : std::min(merged.minY, member->minY);
+        merged.maxY = std::max(merged.maxY, member->maxY);
+        vertexCount += member->vertices.size();
+    }
+    merged.vertices.reserve(vertexCount);
+
+    // Direction par direction, les plages des membres sont mises bout à bout (6 indices = 4 sommets)
+    for (int face = 0; face < 6; ++face) {
+        size_t firstVertex = merged.vertices.size();
+        for (int slot = 0; slot < 4; ++slot) {
+            const ChunkMeshData* member = members[slot];
+            if (!member) continue;
+
+            const NihilEngine::MeshRange& range = member->faceRanges[face];
+            const uint32_t* vertices = member->vertices.data() + range.firstIndex / 6 * 4;
+            const uint32_t* end = vertices + range.indexCount / 6 * 4;
+            for (; vertices != end; ++vertices) {
+                merged.vertices.push_back(NihilEngine::SetVoxelVertexSlot(*vertices, slot % 2, slot / 2));
+            }
+        }
+        merged.faceRanges[face].firstIndex = static_cast<int>(firstVertex / 4 * 6);
+        merged.faceRanges[face].indexCount = static_cast<int>((merged.vertices.size() - firstVertex) / 4 * 6);
+    }
+    return merged;
+}
+
+ChunkMeshData Chunk::BuildMeshData(const ChunkNeighbors& neighbors, MeshingMode mode) {
+    // Quads de 4 sommets : les indices viennent du tampon de quads partagé du moteur
+    ChunkMeshBuilder& builder = ChunkMeshBuilder::GetThreadLocal();
     // grassTopVertices et grassTopIndices supprimés - herbe intégrée dans mainMesh
 
-    for (int x = 0; x < SIZE; ++x) {
-        for (int y = 0; y < SIZE; ++y) {
-            for (int z = 0; z < SIZE; ++z) {
-                const Voxel& voxel = GetVoxel(x, y, z);
-                if (!voxel.active) continue;
+    if (mode != m_MeshedMode) {
+        MarkAllSectionsDirty();
+        m_MeshedMode = mode;
+    }
 
-                bool visible[6] = {true, true, true, true, true, true}; // +Z, -Z, -X, +X, +Y, -Y
+    // 1. Re-meshe uniquement les sections invalidées
+    for (int sectionY = 0; sectionY < SECTION_COUNT; ++sectionY) {
+        if (!(m_DirtySections & (1u << sectionY))) continue;
+
+        // Quads construits directement dans le tampon de la section, repris de la construction
+        // précédente quand plus aucun instantané ne la partage
+        std::shared_ptr<SectionMesh> sectionMesh;
+        if (m_SectionMeshes[sectionY] && m_SectionMeshes[sectionY].use_count() == 1) {
+            // Une copie relâchée par un autre thread l'a été avant cette réutilisation
+            std::atomic_thread_fence(std::memory_order_acquire);
+            sectionMesh = std::const_pointer_cast<SectionMesh>(std::move(m_SectionMeshes[sectionY]));
+        } else {
+            sectionMesh = std::make_shared<SectionMesh>();
+        }
+        builder.Swap(sectionMesh->vertices);
+        builder.Reset();
+        bool hidden = IsSectionHidden(sectionY, neighbors);
+        FaceMasks faces;
+        if (!hidden) ComputeVisibleFaces(sectionY, neighbors, faces);
+
+        for (int face = 0; face < 6; ++face) {
+            sectionMesh->faceOffsets[face] = static_cast<uint32_t>(builder.GetVertices().size());
+            if (hidden) continue;
+
+            if (mode == MeshingMode::Greedy) {
+                BuildGreedyMesh(sectionY, face, faces[face], builder);
+            } else {
+                BuildPerFaceMesh(sectionY, face, faces[face], builder);
+            }
+        }
+        sectionMesh->faceOffsets[6] = static_cast<uint32_t>(builder.GetVertices().size());
+        builder.Swap(sectionMesh->vertices);
+        if (sectionMesh->vertices.empty()) sectionMesh.reset();
+        m_SectionMeshes[sectionY] = std::move(sectionMesh);
+    }
+    m_DirtySections = 0;
+
+    // 2. Assemble les sections direction par direction : chaque direction forme une plage contiguë
+    ChunkMeshData data;
+    builder.Reset();
+    for (int face = 0; face < 6; ++face) {
+        size_t firstQuad = builder.GetQuadCount();
+        for (const auto& sectionMesh : m_SectionMeshes) {
+            if (!sectionMesh) continue;
+            const uint32_t* vertices = sectionMesh->vertices.data();
+            builder.Append(vertices + sectionMesh->faceOffsets[face], vertices + sectionMesh->faceOffsets[face + 1]);
+        }
+        data.faceRanges[face].firstIndex = static_cast<int>(firstQuad * 6);
+        data.faceRanges[face].indexCount = static_cast<int>((builder.GetQuadCount() - firstQuad) * 6);
+    }
 
-                if (z + 1 < SIZE) visible[0] = !GetVoxel(x, y, z + 1).active;
-                if (z - 1 >= 0) visible[1] = !GetVoxel(x, y, z - 1).active;
-                if (x - 1 >= 0) visible[2] = !GetVoxel(x - 1, y, z).active;
-                if (x + 1 < SIZE) visible[3] = !GetVoxel(x + 1, y, z).active;
-                if (y + 1 < SIZE) visible[4] = !GetVoxel(x, y + 1, z).active;
-                if (y - 1 >= 0) visible[5] = !GetVoxel(x, y - 1, z).active;
+    for (int sectionY = 0; sectionY < SECTION_COUNT; ++sectionY) {
+        if (!m_SectionMeshes[sectionY]) continue;
+        if (data.maxY == 0) data.minY = sectionY * SIZE;
+        data.maxY = (sectionY + 1) * SIZE;
+    }
 
-                AddVisibleFacesToMeshes(mainVertices, mainIndices, x, y, z, voxel.type, visible);
+    // Tampon du builder cédé tel quel : il sera rendu par Recycle quand le mesh sera remplacé
+    data.vertices = builder.TakeVertices();
+    return data;
+}
+
+ChunkMeshData Chunk::BuildLODMeshData(const ChunkNeighbors& neighbors, int scale) const {
+    ChunkMeshBuilder& builder = ChunkMeshBuilder::GetThreadLocal();
+    builder.Reset();
+
+    // 1. Grille réduite (x, y, z) des types de cellule
+    const int cells[3] = {SIZE / scale, HEIGHT / scale, SIZE / scale};
+    auto cellIndex = [&cells](const int pos[3]) { return pos[0] + cells[0] * (pos[2] + cells[2] * pos[1]); };
+
+    std::vector<BlockType> grid(static_cast<size_t>(cells[0]) * cells[1] * cells[2], BlockType::Air);
+    int minCellY = cells[1];
+    int maxCellY = -1;
+    for (int sectionY = 0; sectionY < SECTION_COUNT; ++sectionY) {
+        if (!m_Sections[sectionY]) continue;
+
+        int pos[3];
+        for (pos[1] = sectionY * SIZE / scale; pos[1] < (sectionY + 1) * SIZE / scale; ++pos[1]) {
+            for (pos[2] = 0; pos[2] < cells[2]; ++pos[2]) {
+                for (pos[0] = 0; pos[0] < cells[0]; ++pos[0]) {
+                    BlockType type = GetLODCell(pos[0], pos[1], pos[2], scale);
+                    if (type == BlockType::Air) continue;
+
+                    grid[cellIndex(pos)] = type;
+                    minCellY = std::min(minCellY, pos[1]);
+                    maxCellY = std::max(maxCellY, pos[1]);
+                }
             }
         }
     }
 
-    ChunkMeshes meshes;
-    meshes.mainMesh = std::make_unique<NihilEngine::Mesh>(mainVertices, mainIndices, std::vector<NihilEngine::VertexAttribute>{NihilEngine::VertexAttribute::Position, NihilEngine::VertexAttribute::Normal, NihilEngine::VertexAttribute::TexCoord});
+    // Cellule voisine dans le sens de la normale (hors du chunk : voisin chargé, dessous solide, dessus et absent vides)
+    auto isAdjacentSolid = [&](const int pos[3], int face) {
+        const FaceAxes& axes = FACE_AXES[face];
+        int adjacent[3] = {pos[0], pos[1], pos[2]};
+        adjacent[axes.d] += axes.sign;
+
+        if (adjacent[1] < 0) return true;
+        if (adjacent[1] >= cells[1]) return false;
+
+        const Chunk* neighbor = this;
+        int neighborScale = scale;
+        if (adjacent[0] < 0)              { neighbor = neighbors.negX; neighborScale = neighbors.negXScale; adjacent[0] += cells[0]; }
+        else if (adjacent[0] >= cells[0]) { neighbor = neighbors.posX; neighborScale = neighbors.posXScale; adjacent[0] -= cells[0]; }
+        else if (adjacent[2] < 0)         { neighbor = neighbors.negZ; neighborScale = neighbors.negZScale; adjacent[2] += cells[2]; }
+        else if (adjacent[2] >= cells[2]) { neighbor = neighbors.posZ; neighborScale = neighbors.posZScale; adjacent[2] -= cells[2]; }
+
+        if (neighbor == this) return grid[cellIndex(adjacent)] != BlockType::Air;
+
+        // Voisin plus fin : ses cellules ne recouvrent pas forcément toute la face, elle reste visible.
+        // Sinon, la cellule du voisin (à sa propre échelle) qui contient la cellule adjacente
+        if (!neighbor || neighborScale < scale) return false;
+        return neighbor->GetLODCell(adjacent[0] * scale / neighborScale, adjacent[1] * scale / neighborScale,
+                                    adjacent[2] * scale / neighborScale, neighborScale) != BlockType::Air;
+    };
 
-    // grassTopMeshes supprimé - herbe intégrée dans mainMesh
-    return meshes;
+    // 2. Faces visibles fusionnées tranche par tranche, comme BuildGreedyMesh
+    ChunkMeshData data;
+    std::vector<BlockType> mask;
+    for (int face = 0; face < 6; ++face) {
+        const FaceAxes& axes = FACE_AXES[face];
+        const int width = cells[axes.u];
+        const int height = cells[axes.v];
+        mask.assign(static_cast<size_t>(width) * height, BlockType::Air);
+        size_t firstQuad = builder.GetQuadCount();
+
+        for (int slice = 0; slice < cells[axes.d]; ++slice) {
+            for (int v = 0; v < height; ++v) {
+                for (int u = 0; u < width; ++u) {
+                    int pos[3];
+                    pos[axes.d] = slice;
+                    pos[axes.u] = u;
+                    pos[axes.v] = v;
+
+                    BlockType type = grid[cellIndex(pos)];
+                    mask[u + v * width] = (type != BlockType::Air && !isAdjacentSolid(pos, face)) ? type : BlockType::Air;
+                }
+            }
+
+            for (int v = 0; v < height; ++v) {
+                for (int u = 0; u < width; ) {
+                    BlockType type = mask[u + v * width];
+                    if (type == BlockType::Air) {
+                        ++u;
+                        continue;
+                    }
+
+                    int quadWidth = 1;
+                    while (u + quadWidth < width && mask[u + quadWidth + v * width] == type) {
+                        ++quadWidth;
+                    }
+
+                    int quadHeight = 1;
+                    bool canExtend = true;
+                    while (v + quadHeight < height && canExtend) {
+                        for (int k = 0; k < quadWidth; ++k) {
+                            if (mask[u + k + (v + quadHeight) * width] != type) {
+                                canExtend = false;
+                                break;
+                            }
+                        }
+                        if (canExtend) ++quadHeight;
+                    }
+
+                    int origin[3];
+                    origin[axes.d] = (slice + (axes.sign > 0 ? 1 : 0)) * scale;
+                    origin[axes.u] = u * scale;
+                    origin[axes.v] = v * scale;
+                    AddQuad(builder, face, type, origin, quadWidth * scale, quadHeight * scale);
+
+                    for (int dv = 0; dv < quadHeight; ++dv) {
+                        for (int du = 0; du < quadWidth; ++du) {
+                            mask[u + du + (v + dv) * width] = BlockType::Air;
+                        }
+                    }
+                    u += quadWidth;
+                }
+            }
+        }
+
+        data.faceRanges[face].firstIndex = static_cast<int>(firstQuad * 6);
+        data.faceRanges[face].indexCount = static_cast<int>((builder.GetQuadCount() - firstQuad) * 6);
+    }
+
+    if (maxCellY >= 0) {
+        data.minY = minCellY * scale;
+        data.maxY = (maxCellY + 1) * scale;
+    }
+    data.vertices = builder.TakeVertices();
+    return data;
+}
+
+BlockType Chunk::GetLODCell(int cellX, int cellY, int cellZ, int scale) const {
+    int baseY = cellY * scale;
+    const Section* section = m_Sections[baseY / SIZE].get();
+    if (!section) return BlockType::Air;
+
+    // Bits de la cellule dans les colonnes de la section (une cellule ne chevauche jamais deux sections)
+    int localY = baseY % SIZE;
+    uint32_t range = ((1u << scale) - 1u) << localY;
+
+    int solidCount = 0;
+    int topY = -1;
+    int topX = 0;
+    int topZ = 0;
+    for (int z = cellZ * scale; z < (cellZ + 1) * scale; ++z) {
+        for (int x = cellX * scale; x < (cellX + 1) * scale; ++x) {
+            uint32_t bits = section->occupancy.GetColumn(x, z) & range;
+            if (bits == 0) continue;
+
+            uint32_t count = bits;
+            while (count != 0) {
+                count &= count - 1;
+                ++solidCount;
+            }
+
+            int highest = 31 - CountLeadingZeros(bits);
+            if (highest > topY) {
+                topY = highest;
+                topX = x;
+                topZ = z;
+            }
+        }
+    }
+
+    if (solidCount * 2 < scale * scale * scale) return BlockType::Air;
+    return static_cast<BlockType>(section->voxels.Get(GetIndex(topX, topY, topZ)));
+}
+
+void Chunk::ComputeVisibleFaces(int sectionY, const ChunkNeighbors& neighbors, FaceMasks& faces) const {
+    const SectionOccupancy& occupancy = m_Sections[sectionY]->occupancy;
+
+    // Lignes de la section adjacente le long d'un axe (air si absente)
+    auto adjacentLines = [](const Chunk* chunk, int adjacentY, int axis) -> const SectionOccupancy::Lines& {
+        if (!chunk) return SectionOccupancy::EmptyLines();
+        if (adjacentY < 0) return SectionOccupancy::FullLines(); // Dessous du monde : jamais visible
+        if (adjacentY >= SECTION_COUNT) return SectionOccupancy::EmptyLines();
+        const Section* section = chunk->m_Sections[adjacentY].get();
+        return section ? section->occupancy.GetLines(axis) : SectionOccupancy::EmptyLines();
+    };
+
+    const SectionOccupancy::Lines* adjacent[6] = {
+        &adjacentLines(neighbors.posZ, sectionY, 2),
+        &adjacentLines(neighbors.negZ, sectionY, 2),
+        &adjacentLines(neighbors.negX, sectionY, 0),
+        &adjacentLines(neighbors.posX, sectionY, 0),
+        &adjacentLines(this, sectionY + 1, 1),
+        &adjacentLines(this, sectionY - 1, 1)
+    };
+
+    for (int face = 0; face < 6; ++face) {
+        const FaceAxes& axes = FACE_AXES[face];
+        SectionOccupancy::ExtractFaces(occupancy.GetLines(axes.d), *adjacent[face], axes.sign > 0, faces[face]);
+    }
 }
 
-// Logique d'ajout de faces (extraite de VoxelWorld.cpp)
-void Chunk::AddVisibleFacesToMeshes(std::vector<float>& mainVertices, std::vector<unsigned int>& mainIndices,
-                                   int x, int y, int z, BlockType type, const bool visible[6]) const {
+void Chunk::BuildPerFaceMesh(int sectionY, int face, const SectionOccupancy::Lines& faceLines, ChunkMeshBuilder& builder) const {
+    const int baseY = sectionY * SIZE;
+    const FaceAxes& axes = FACE_AXES[face];
 
-    // [Logique de AddVisibleFacesToMeshes - Inchangée]
-    float px = static_cast<float>(x), py = static_cast<float>(y), pz = static_cast<float>(z);
+    for (int line = 0; line < SectionOccupancy::LINE_COUNT; ++line) {
+        uint32_t bits = faceLines[line];
+        while (bits != 0) {
+            int bit = CountTrailingZeros(bits);
+            bits &= bits - 1;
 
-    float side_u_min = 0.0f, side_u_max = 1.0f;
-    float top_u_min = 0.0f, top_u_max = 1.0f;
-    float bottom_u_min = 0.0f, bottom_u_max = 1.0f;
-    float v_min = 0.0f, v_max = 0.5f;
+            int pos[3];
+            LinePosition(axes.d, line, bit, pos);
+            pos[1] += baseY;
+            BlockType type = GetVoxel(pos[0], pos[1], pos[2]).type;
 
+            // Un quad 1x1 par face non recouverte
+            if (axes.sign > 0) pos[axes.d] += 1;
+            AddQuad(builder, face, type, pos, 1, 1);
+        }
+    }
+}
+
+void Chunk::BuildGreedyMesh(int sectionY, int face, const SectionOccupancy::Lines& faceLines, ChunkMeshBuilder& builder) const {
+    const int baseY = sectionY * SIZE;
+    const FaceAxes& axes = FACE_AXES[face];
+
+    // Masque des faces visibles d'une tranche : type du bloc, ou Air si la face est cachée
+    std::array<BlockType, SIZE * SIZE> mask;
+
+    for (int slice = 0; slice < SIZE; ++slice) {
+        // 1. Construit le masque de la tranche
+        for (int v = 0; v < SIZE; ++v) {
+            for (int u = 0; u < SIZE; ++u) {
+                int pos[3];
+                pos[axes.d] = slice;
+                pos[axes.u] = u;
+                pos[axes.v] = v;
+
+                BlockType type = BlockType::Air;
+                if ((faceLines[LineIndex(axes.d, pos)] >> pos[axes.d]) & 1u) {
+                    type = GetVoxel(pos[0], pos[1] + baseY, pos[2]).type;
+                }
+                mask[u + v * SIZE] = type;
+            }
+        }
+
+        // 2. Fusionne les faces identiques en rectangles maximaux (largeur puis hauteur)
+        for (int v = 0; v < SIZE; ++v) {
+            for (int u = 0; u < SIZE; ) {
+                BlockType type = mask[u + v * SIZE];
+                if (type == BlockType::Air) {
+                    ++u;
+                    continue;
+                }
+
+                int width = 1;
+                while (u + width < SIZE && mask[u + width + v * SIZE] == type) {
+                    ++width;
+                }
+
+                int height = 1;
+                bool canExtend = true;
+                while (v + height < SIZE && canExtend) {
+                    for (int k = 0; k < width; ++k) {
+                        if (mask[u + k + (v + height) * SIZE] != type) {
+                            canExtend = false;
+                            break;
+                        }
+                    }
+                    if (canExtend) ++height;
+                }
+
+                int origin[3];
+                origin[axes.d] = slice + (axes.sign > 0 ? 1 : 0);
+                origin[axes.u] = u;
+                origin[axes.v] = v;
+                origin[1] += baseY;
+                AddQuad(builder, face, type, origin, width, height);
+
+                for (int dv = 0; dv < height; ++dv) {
+                    for (int du = 0; du < width; ++du) {
+                        mask[u + du + (v + dv) * SIZE] = BlockType::Air;
+                    }
+                }
+                u += width;
+            }
+        }
+    }
+}
+
+void Chunk::AddQuad(ChunkMeshBuilder& builder, int face, BlockType type, const int origin[3], int width, int height) {
+    int tile = GetAtlasTile(type, face);
+    if (tile < 0) return;
+
+    const FaceAxes& axes = FACE_AXES[face];
+
+    // Normale et UV sont reconstruites par le shader à partir de la face et de la position
+    uint32_t packed[4];
+    for (int k = 0; k < 4; ++k) {
+        int pos[3] = {origin[0], origin[1], origin[2]};
+        pos[axes.u] += axes.corners[k][0] * width;
+        pos[axes.v] += axes.corners[k][1] * height;
+        packed[k] = NihilEngine::PackVoxelVertex(pos[0], pos[1], pos[2], face, tile);
+    }
+    builder.PushQuad(packed[0], packed[1], packed[2], packed[3]);
+}
+
+int Chunk::GetAtlasTile(BlockType type, int face) {
+    // Tuiles de la première ligne de l'atlas : 0 herbe (dessus), 1 herbe (côté), 2 terre, 3 pierre
     switch (type) {
         case BlockType::Grass:
-            top_u_min = 0.0f; top_u_max = 0.25f;
-            side_u_min = 0.25f; side_u_max = 0.5f;
-            bottom_u_min = 0.5f; bottom_u_max = 0.75f;
-            break;
+            if (face == 4) return 0;  // Dessus
+            if (face == 5) return 2;  // Dessous (terre)
+            return 1;                 // Côtés
         case BlockType::Dirt:
-            side_u_min = top_u_min = bottom_u_min = 0.5f;
-            side_u_max = top_u_max = bottom_u_max = 0.75f;
-            break;
+            return 2;
         case BlockType::Stone:
-            side_u_min = top_u_min = bottom_u_min = 0.75f;
-            side_u_max = top_u_max = bottom_u_max = 1.0f;
-            break;
+            return 3;
         default:
-            return;
-    }
-
-    auto addFace = [](std::vector<float>& vertices, std::vector<unsigned int>& indices, unsigned int& vertexOffset,
-                      const std::array<float, 32>& faceVertices, const std::array<unsigned int, 6>& faceIndices) {
-        vertices.insert(vertices.end(), faceVertices.begin(), faceVertices.end());
-        for (unsigned int idx : faceIndices) {
-            indices.push_back(vertexOffset + idx);
-        }
-        vertexOffset += 4;
-    };
-
-    unsigned int mainVertexOffset = mainVertices.size() / 8;
-
-    int worldX = m_ChunkX * SIZE + x;
-    int worldZ = m_ChunkZ * SIZE + z;
-    Constants::BiomeType blockBiome = GetBiomeAt(worldX, worldZ);
-    int biomeIndex = static_cast<int>(blockBiome);
-
-    // Front face (+Z)
-    if (visible[0]) {
-        glm::vec3 normal = {0.0f, 0.0f, 1.0f};
-        std::array<float, 32> faceVertices = {
-            px, py, pz + 1,  normal.x, normal.y, normal.z, side_u_min, v_min,
-            px + 1, py, pz + 1,  normal.x, normal.y, normal.z, side_u_max, v_min,
-            px + 1, py + 1, pz + 1,  normal.x, normal.y, normal.z, side_u_max, v_max,
-            px, py + 1, pz + 1,  normal.x, normal.y, normal.z, side_u_min, v_max
-        };
-        std::array<unsigned int, 6> faceIndices = {0, 1, 2, 2, 3, 0};
-        addFace(mainVertices, mainIndices, mainVertexOffset, faceVertices, faceIndices);
-    }
-
-    // Back face (-Z)
-    if (visible[1]) {
-        glm::vec3 normal = {0.0f, 0.0f, -1.0f};
-        std::array<float, 32> faceVertices = {
-            px + 1, py, pz,  normal.x, normal.y, normal.z, side_u_min, v_min,
-            px, py, pz,  normal.x, normal.y, normal.z, side_u_max, v_min,
-            px, py + 1, pz,  normal.x, normal.y, normal.z, side_u_max, v_max,
-            px + 1, py + 1, pz,  normal.x, normal.y, normal.z, side_u_min, v_max
-        };
-        std::array<unsigned int, 6> faceIndices = {0, 1, 2, 2, 3, 0};
-        addFace(mainVertices, mainIndices, mainVertexOffset, faceVertices, faceIndices);
-    }
-
-    // Left face (-X)
-    if (visible[2]) {
-        glm::vec3 normal = {-1.0f, 0.0f, 0.0f};
-        std::array<float, 32> faceVertices = {
-            px, py, pz + 1,  normal.x, normal.y, normal.z, side_u_min, v_min,
-            px, py, pz,  normal.x, normal.y, normal.z, side_u_max, v_min,
-            px, py + 1, pz,  normal.x, normal.y, normal.z, side_u_max, v_max,
-            px, py + 1, pz + 1,  normal.x, normal.y, normal.z, side_u_min, v_max
-        };
-        std::array<unsigned int, 6> faceIndices = {0, 1, 2, 2, 3, 0};
-        addFace(mainVertices, mainIndices, mainVertexOffset, faceVertices, faceIndices);
-    }
-
-    // Right face (+X)
-    if (visible[3]) {
-        glm::vec3 normal = {1.0f, 0.0f, 0.0f};
-        std::array<float, 32> faceVertices = {
-            px + 1, py, pz,         normal.x, normal.y, normal.z, side_u_min, v_min,
-            px + 1, py, pz + 1,     normal.x, normal.y, normal.z, side_u_max, v_min,
-            px + 1, py + 1, pz + 1, normal.x, normal.y, normal.z, side_u_max, v_max,
-            px + 1, py + 1, pz,     normal.x, normal.y, normal.z, side_u_min, v_max
-        };
-        std::array<unsigned int, 6> faceIndices = {0, 1, 2, 2, 3, 0};
-        addFace(mainVertices, mainIndices, mainVertexOffset, faceVertices, faceIndices);
-    }
-
-    // Top face (+Y)
-    if (visible[4]) {
-        float u_min = (type == BlockType::Grass) ? top_u_min : side_u_min;
-        float u_max = (type == BlockType::Grass) ? top_u_max : side_u_max;
-        glm::vec3 normal = {0.0f, 1.0f, 0.0f};
-        std::array<float, 32> faceVertices = {
-            px, py + 1, pz + 1,     normal.x, normal.y, normal.z, u_min, v_min,
-            px + 1, py + 1, pz + 1, normal.x, normal.y, normal.z, u_max, v_min,
-            px + 1, py + 1, pz,     normal.x, normal.y, normal.z, u_max, v_max,
-            px, py + 1, pz,         normal.x, normal.y, normal.z, u_min, v_max
-        };
-        std::array<unsigned int, 6> faceIndices = {0, 1, 2, 2, 3, 0};
-
-        // INTÉGRATION DE L'HERBE : Toujours ajouter au mainMesh maintenant
-        addFace(mainVertices, mainIndices, mainVertexOffset, faceVertices, faceIndices);
-    }
-
-    // Bottom face (-Y)
-    if (visible[5]) {
-        glm::vec3 normal = {0.0f, -1.0f, 0.0f};
-        std::array<float, 32> faceVertices = {
-            px, py, pz,         normal.x, normal.y, normal.z, bottom_u_min, v_min,
-            px + 1, py, pz,     normal.x, normal.y, normal.z, bottom_u_max, v_min,
-            px + 1, py, pz + 1, normal.x, normal.y, normal.z, bottom_u_max, v_max,
-            px, py, pz + 1,     normal.x, normal.y, normal.z, bottom_u_min, v_max
-        };
-        std::array<unsigned int, 6> faceIndices = {0, 1, 2, 2, 3, 0};
-        addFace(mainVertices, mainIndices, mainVertexOffset, faceVertices, faceIndices);
-    }
-}
-
-Voxel& Chunk::GetVoxel(int x, int y, int z) {
-    return m_Voxels[GetIndex(x, y, z)];
-}
-
-const Voxel& Chunk::GetVoxel(int x, int y, int z) const {
-    return m_Voxels[GetIndex(x, y, z)];
-}
-
-int Chunk::GetIndex(int x, int y, int z) const {
-    return x + y * SIZE + z * SIZE * SIZE;
-}
-
-Constants::BiomeType Chunk::GetBiomeAt(int worldX, int worldZ) {
-    // Logique de biome simplifiée (extraite de VoxelWorld.cpp)
-    float distance = std::sqrt(static_cast<float>(worldX * worldX + worldZ * worldZ));
-    if (distance < 20) {
-        return Constants::BiomeType::Plains;
-    } else if (worldX > 0) {
-        return Constants::BiomeType::Forest;
-    } else if (worldZ > 0) {
-        return Constants::BiomeType::Desert;
-    } else {
-        return Constants::BiomeType::Tundra;
+            return -1;
     }
 }
 
@@ -0,0 +1,46 @@
+// src/ChunkMeshBuilder.cpp
+#include <MonJeu/ChunkMeshBuilder.h>
+#include <mutex>
+
+namespace MonJeu {
+
+namespace {
+    // Tampons rendus par le thread principal, repris par les threads de meshing
+    std::mutex g_RecycledMutex;
+    std::vector<std::vector<uint32_t>> g_RecycledBuffers;
+}
+
+ChunkMeshBuilder::ChunkMeshBuilder(size_t reservedQuads) {
+    m_Vertices.reserve(reservedQuads * 4);
+}
+
+std::vector<uint32_t> ChunkMeshBuilder::TakeVertices() {
+    std::vector<uint32_t> vertices = std::move(m_Vertices);
+    m_Vertices = std::vector<uint32_t>();
+    {
+        std::lock_guard<std::mutex> lock(g_RecycledMutex);
+        if (!g_RecycledBuffers.empty()) {
+            m_Vertices = std::move(g_RecycledBuffers.back());
+            g_RecycledBuffers.pop_back();
+        }
+    }
+    m_Vertices.clear();
+    m_Vertices.reserve(vertices.size());
+    return vertices;
+}
+
+void ChunkMeshBuilder::Recycle(std::vector<uint32_t>&& vertices) {
+    if (vertices.capacity() == 0) return;
+
+    std::lock_guard<std::mutex> lock(g_RecycledMutex);
+    if (g_RecycledBuffers.size() < MAX_RECYCLED_BUFFERS) {
+        g_RecycledBuffers.push_back(std::move(vertices));
+    }
+}
+
+ChunkMeshBuilder& ChunkMeshBuilder::GetThreadLocal() {
+    static thread_local ChunkMeshBuilder builder;
+    return builder;
+}
+
+} // namespace MonJeu
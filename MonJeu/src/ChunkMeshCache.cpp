@@ -0,0 +1,210 @@
+// src/ChunkMeshCache.cpp
+#include <MonJeu/ChunkMeshCache.h>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace MonJeu {
+
+namespace {
+    // Format binaire:
+    // - magic (uint32_t), version (uint32_t), nombre d'entrées (uint32_t)
+    // - pour chaque entrée, de la plus récente à la plus ancienne :
+    //   hash (uint64_t), minY / maxY (int32_t), 6 plages (firstIndex, indexCount : int32_t),
+    //   nombre de sommets (uint32_t), sommets empaquetés (uint32_t)
+    const uint32_t FILE_MAGIC = 0x48534D4E; // "NMSH"
+    const uint32_t FILE_VERSION = 1;
+    const size_t HEADER_SIZE = 3 * sizeof(uint32_t);
+    const size_t ENTRY_HEADER_SIZE = sizeof(uint64_t) + 2 * sizeof(int32_t) + 12 * sizeof(int32_t) + sizeof(uint32_t);
+
+    template <typename T>
+    void Append(std::vector<uint8_t>& bytes, const T& value) {
+        size_t offset = bytes.size();
+        bytes.resize(offset + sizeof(T));
+        std::memcpy(bytes.data() + offset, &value, sizeof(T));
+    }
+
+    template <typename T>
+    T Read(const std::vector<uint8_t>& bytes, size_t& offset) {
+        T value;
+        std::memcpy(&value, bytes.data() + offset, sizeof(T));
+        offset += sizeof(T);
+        return value;
+    }
+
+    // Parcourt les entrées d'un fichier valide : visitor(hash, début, taille en octets) renvoie false pour s'arrêter
+    template <typename Visitor>
+    bool ForEachEntry(const std::vector<uint8_t>& bytes, Visitor visitor) {
+        if (bytes.size() < HEADER_SIZE) return false;
+
+        size_t offset = 0;
+        uint32_t magic = Read<uint32_t>(bytes, offset);
+        uint32_t version = Read<uint32_t>(bytes, offset);
+        uint32_t entryCount = Read<uint32_t>(bytes, offset);
+        if (magic != FILE_MAGIC || version != FILE_VERSION) return false;
+
+        for (uint32_t entry = 0; entry < entryCount; ++entry) {
+            if (bytes.size() - offset < ENTRY_HEADER_SIZE) return false;
+
+            size_t start = offset;
+            uint64_t hash = Read<uint64_t>(bytes, offset);
+            offset = start + ENTRY_HEADER_SIZE - sizeof(uint32_t);
+            uint32_t vertexCount = Read<uint32_t>(bytes, offset);
+            if ((bytes.size() - offset) / sizeof(uint32_t) < vertexCount) return false;
+
+            offset += vertexCount * sizeof(uint32_t);
+            if (!visitor(hash, start, offset - start)) break;
+        }
+        return true;
+    }
+}
+
+ChunkMeshCache::ChunkMeshCache(const std::filesystem::path& directory)
+    : m_Directory(directory) {}
+
+bool ChunkMeshCache::Load(int chunkX, int chunkZ, uint64_t hash, ChunkMeshData& data) const {
+    std::vector<uint8_t> bytes;
+    if (!ReadFile(GetCachePath(chunkX, chunkZ), bytes)) return false;
+
+    bool found = false;
+    ForEachEntry(bytes, [&](uint64_t entryHash, size_t start, size_t) {
+        if (entryHash != hash) return true;
+
+        size_t offset = start + sizeof(uint64_t);
+        int32_t minY = Read<int32_t>(bytes, offset);
+        int32_t maxY = Read<int32_t>(bytes, offset);
+        std::array<NihilEngine::MeshRange, 6> faceRanges;
+        for (NihilEngine::MeshRange& range : faceRanges) {
+            range.firstIndex = Read<int32_t>(bytes, offset);
+            range.indexCount = Read<int32_t>(bytes, offset);
+        }
+        uint32_t vertexCount = Read<uint32_t>(bytes, offset);
+
+        // Fichier abîmé ou étranger au hash identique : les plages servent d'arithmétique de pointeurs
+        // (MergeMeshData) et d'appels de dessin sans contrôle, l'entrée est ignorée
+        if (!IsValidEntry(minY, maxY, faceRanges, vertexCount)) return false;
+
+        data.minY = minY;
+        data.maxY = maxY;
+        data.faceRanges = faceRanges;
+        data.vertices.resize(vertexCount);
+        std::memcpy(data.vertices.data(), bytes.data() + offset, vertexCount * sizeof(uint32_t));
+
+        found = true;
+        return false;
+    });
+    return found;
+}
+
+bool ChunkMeshCache::Store(int chunkX, int chunkZ, uint64_t hash, const ChunkMeshData& data) const {
+    auto path = GetCachePath(chunkX, chunkZ);
+
+    std::vector<uint8_t> bytes;
+    Append(bytes, FILE_MAGIC);
+    Append(bytes, FILE_VERSION);
+    Append(bytes, uint32_t(1));
+
+    // Nouvelle entrée en tête
+    Append(bytes, hash);
+    Append(bytes, static_cast<int32_t>(data.minY));
+    Append(bytes, static_cast<int32_t>(data.maxY));
+    for (const NihilEngine::MeshRange& range : data.faceRanges) {
+        Append(bytes, static_cast<int32_t>(range.firstIndex));
+        Append(bytes, static_cast<int32_t>(range.indexCount));
+    }
+    Append(bytes, static_cast<uint32_t>(data.vertices.size()));
+    size_t offset = bytes.size();
+    bytes.resize(offset + data.vertices.size() * sizeof(uint32_t));
+    std::memcpy(bytes.data() + offset, data.vertices.data(), data.vertices.size() * sizeof(uint32_t));
+
+    // Puis les entrées précédentes encore valides, dans la limite de MAX_ENTRIES
+    std::vector<uint8_t> previous;
+    uint32_t entryCount = 1;
+    if (ReadFile(path, previous)) {
+        ForEachEntry(previous, [&](uint64_t entryHash, size_t start, size_t size) {
+            if (entryCount >= MAX_ENTRIES) return false;
+            if (entryHash == hash) return true;
+            bytes.insert(bytes.end(), previous.begin() + start, previous.begin() + start + size);
+            ++entryCount;
+            return true;
+        });
+    }
+    std::memcpy(bytes.data() + 2 * sizeof(uint32_t), &entryCount, sizeof(uint32_t));
+
+    try {
+        std::filesystem::create_directories(path.parent_path());
+    } catch (const std::filesystem::filesystem_error& e) {
+        std::cerr << "Erreur lors de la création du dossier du cache de meshes: " << e.what() << std::endl;
+        return false;
+    }
+
+    // Écriture dans un fichier temporaire puis remplacement : une écriture interrompue (arrêt, disque
+    // plein) laisse l'ancien fichier et ses variantes intacts
+    std::filesystem::path tempPath = path;
+    tempPath += ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            std::cerr << "Erreur: impossible d'ouvrir le cache de mesh pour écriture: " << tempPath << std::endl;
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        file.close();
+        if (!file) {
+            std::cerr << "Erreur lors de l'écriture du cache de mesh: " << tempPath << std::endl;
+            std::error_code ignored;
+            std::filesystem::remove(tempPath, ignored);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error) {
+        std::cerr << "Erreur lors du remplacement du cache de mesh " << path << ": " << error.message() << std::endl;
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+    return true;
+}
+
+bool ChunkMeshCache::IsValidEntry(int32_t minY, int32_t maxY, const std::array<NihilEngine::MeshRange, 6>& faceRanges,
+                                  uint32_t vertexCount) {
+    if (vertexCount % 4 != 0) return false;
+    if (minY < 0 || minY > maxY || maxY > Chunk::HEIGHT) return false;
+
+    // Plages contiguës de quads entiers, de la première direction à la dernière, dans les sommets
+    const int64_t quadIndexCount = static_cast<int64_t>(vertexCount) / 4 * 6;
+    int64_t nextIndex = 0;
+    for (const NihilEngine::MeshRange& range : faceRanges) {
+        if (range.firstIndex != nextIndex || range.firstIndex % 6 != 0) return false;
+        if (range.indexCount < 0 || range.indexCount % 6 != 0) return false;
+        nextIndex = static_cast<int64_t>(range.firstIndex) + range.indexCount;
+        if (nextIndex > quadIndexCount) return false;
+    }
+    return true;
+}
+
+std::filesystem::path ChunkMeshCache::GetCachePath(int chunkX, int chunkZ) const {
+    // Même découpage en dossiers que les chunks sauvegardés
+    std::stringstream ss;
+    ss << "chunk_" << chunkX << "_" << chunkZ << ".mesh";
+    const int folder = Constants::CHUNKS_PER_SAVE_FOLDER;
+    return m_Directory / std::to_string(chunkX / folder) / std::to_string(chunkZ / folder) / ss.str();
+}
+
+bool ChunkMeshCache::ReadFile(const std::filesystem::path& path, std::vector<uint8_t>& bytes) const {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+
+    std::streamsize size = file.tellg();
+    if (size <= 0) return false;
+    file.seekg(0, std::ios::beg);
+
+    bytes.resize(static_cast<size_t>(size));
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(bytes.data()), size));
+}
+
+} // namespace MonJeu
@@ -2,16 +2,17 @@
 #include <MonJeu/ChunkSerializer.h>
 #include <iostream>
 #include <cstring>
+#include <stdexcept>
 
 namespace MonJeu {
 
 std::vector<uint8_t> ChunkSerializer::SerializeChunk(const Chunk& chunk) {
-    std::vector<uint8_t> data(TOTAL_SIZE);
+    std::vector<uint8_t> data(HEADER_SIZE);
 
     size_t offset = 0;
 
     // Version
-    uint32_t version = 1;
+    uint32_t version = CURRENT_VERSION;
     std::memcpy(data.data() + offset, &version, sizeof(uint32_t));
     offset += sizeof(uint32_t);
 
@@ -30,19 +31,27 @@ std::vector<uint8_t> ChunkSerializer::SerializeChunk(const Chunk& chunk) {
     std::memcpy(data.data() + offset, &biome, sizeof(uint8_t));
     offset += sizeof(uint8_t);
 
-    // voxelData
-    for (int y = 0; y < Chunk::SIZE; ++y) {
-        for (int z = 0; z < Chunk::SIZE; ++z) {
-            for (int x = 0; x < Chunk::SIZE; ++x) {
-                const Voxel& voxel = chunk.GetVoxel(x, y, z);
-
-                // type
-                uint8_t type = static_cast<uint8_t>(voxel.type);
-                data[offset++] = type;
+    // voxelData : les sections vides ou homogènes ne coûtent qu'un ou deux octets
+    data.push_back(static_cast<uint8_t>(Chunk::SECTION_COUNT));
+    for (int sectionY = 0; sectionY < Chunk::SECTION_COUNT; ++sectionY) {
+        const PalettedVoxelStorage* section = chunk.GetSection(sectionY);
+        if (!section) {
+            data.push_back(SECTION_EMPTY);
+            continue;
+        }
+        if (section->IsUniform()) {
+            data.push_back(SECTION_UNIFORM);
+            data.push_back(section->Get(0));
+            continue;
+        }
 
-                // active
-                uint8_t active = voxel.active ? 1 : 0;
-                data[offset++] = active;
+        data.push_back(SECTION_FULL);
+        int baseY = sectionY * Chunk::SIZE;
+        for (int y = baseY; y < baseY + Chunk::SIZE; ++y) {
+            for (int z = 0; z < Chunk::SIZE; ++z) {
+                for (int x = 0; x < Chunk::SIZE; ++x) {
+                    data.push_back(static_cast<uint8_t>(chunk.GetVoxel(x, y, z).type));
+                }
             }
         }
     }
@@ -54,7 +63,7 @@ ChunkSerializer::SerializedChunk ChunkSerializer::DeserializeChunk(const std::ve
     SerializedChunk result;
     size_t offset = 0;
 
-    if (data.size() != TOTAL_SIZE) {
+    if (data.size() < HEADER_SIZE) {
         throw std::runtime_error("Invalid chunk data size");
     }
 
@@ -63,9 +72,12 @@ ChunkSerializer::SerializedChunk ChunkSerializer::DeserializeChunk(const std::ve
     std::memcpy(&version, data.data() + offset, sizeof(uint32_t));
     offset += sizeof(uint32_t);
 
-    if (version != 1) {
+    if (version != 1 && version != CURRENT_VERSION) {
         throw std::runtime_error("Unsupported chunk data version");
     }
+    if (version == 1 && data.size() != V1_TOTAL_SIZE) {
+        throw std::runtime_error("Invalid chunk data size");
+    }
     result.version = version;
 
     // chunkX
@@ -86,9 +98,8 @@ ChunkSerializer::SerializedChunk ChunkSerializer::DeserializeChunk(const std::ve
     offset += sizeof(uint8_t);
     result.biome = static_cast<Constants::BiomeType>(biome);
 
-    // voxelData
-    result.voxelData.resize(CHUNK_DATA_SIZE);
-    std::memcpy(result.voxelData.data(), data.data() + offset, CHUNK_DATA_SIZE);
+    // voxelData (validée à la lecture des sections pour la v2)
+    result.voxelData.assign(data.begin() + offset, data.end());
 
     return result;
 }
@@ -98,45 +109,79 @@ void ChunkSerializer::ApplySerializedDataToChunk(Chunk& chunk, const SerializedC
         throw std::runtime_error("Chunk coordinates mismatch");
     }
 
-    size_t offset = 0;
-    for (int y = 0; y < Chunk::SIZE; ++y) {
-        for (int z = 0; z < Chunk::SIZE; ++z) {
-            for (int x = 0; x < Chunk::SIZE; ++x) {
-                Voxel& voxel = chunk.GetVoxel(x, y, z);
-
-                // type
-                uint8_t type = data.voxelData[offset++];
-                voxel.type = static_cast<BlockType>(type);
-
-                // active
-                uint8_t active = data.voxelData[offset++];
-                voxel.active = (active != 0);
-            }
-        }
-    }
+    ReadVoxelData(chunk, data);
 }
 
 std::unique_ptr<Chunk> ChunkSerializer::CreateChunkFromSerializedData(const SerializedChunk& data) {
     auto chunk = std::make_unique<Chunk>(data.chunkX, data.chunkZ, data.biome);
+    ReadVoxelData(*chunk, data);
+    return chunk;
+}
 
+void ChunkSerializer::ReadVoxelData(Chunk& chunk, const SerializedChunk& data) {
     size_t offset = 0;
-    for (int y = 0; y < Chunk::SIZE; ++y) {
-        for (int z = 0; z < Chunk::SIZE; ++z) {
-            for (int x = 0; x < Chunk::SIZE; ++x) {
-                Voxel& voxel = chunk->GetVoxel(x, y, z);
-
-                // type
-                uint8_t type = data.voxelData[offset++];
-                voxel.type = static_cast<BlockType>(type);
-
-                // active
-                uint8_t active = data.voxelData[offset++];
-                voxel.active = (active != 0);
+
+    if (data.version == 1) {
+        // Ancien format : une seule section au bas de la colonne
+        for (int y = 0; y < Chunk::SIZE; ++y) {
+            for (int z = 0; z < Chunk::SIZE; ++z) {
+                for (int x = 0; x < Chunk::SIZE; ++x) {
+                    // type
+                    uint8_t type = data.voxelData[offset++];
+
+                    // active : un voxel inactif est de l'air quel que soit son type
+                    uint8_t active = data.voxelData[offset++];
+                    chunk.SetVoxel(x, y, z, active != 0 ? static_cast<BlockType>(type) : BlockType::Air);
+                }
             }
         }
+        chunk.CompactSections();
+        return;
     }
 
-    return chunk;
+    const std::vector<uint8_t>& bytes = data.voxelData;
+    auto require = [&](size_t count) {
+        if (offset + count > bytes.size()) {
+            throw std::runtime_error("Truncated chunk section data");
+        }
+    };
+
+    require(1);
+    int sectionCount = bytes[offset++];
+    if (sectionCount > Chunk::SECTION_COUNT) {
+        throw std::runtime_error("Too many chunk sections");
+    }
+
+    for (int sectionY = 0; sectionY < Chunk::SECTION_COUNT; ++sectionY) {
+        if (sectionY >= sectionCount) {
+            chunk.FillSection(sectionY, BlockType::Air);
+            continue;
+        }
+
+        require(1);
+        uint8_t tag = bytes[offset++];
+        if (tag == SECTION_EMPTY) {
+            chunk.FillSection(sectionY, BlockType::Air);
+        } else if (tag == SECTION_UNIFORM) {
+            require(1);
+            chunk.FillSection(sectionY, static_cast<BlockType>(bytes[offset++]));
+        } else if (tag == SECTION_FULL) {
+            require(SECTION_VOLUME);
+            chunk.FillSection(sectionY, BlockType::Air);
+            int baseY = sectionY * Chunk::SIZE;
+            for (int y = baseY; y < baseY + Chunk::SIZE; ++y) {
+                for (int z = 0; z < Chunk::SIZE; ++z) {
+                    for (int x = 0; x < Chunk::SIZE; ++x) {
+                        chunk.SetVoxel(x, y, z, static_cast<BlockType>(bytes[offset++]));
+                    }
+                }
+            }
+        } else {
+            throw std::runtime_error("Invalid chunk section tag");
+        }
+    }
+
+    chunk.CompactSections();
 }
 
-} // namespace MonJeu
\ No newline at end of file
+} // namespace MonJeu
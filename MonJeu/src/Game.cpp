@@ -12,7 +12,7 @@
 namespace MonJeu {
 
 Game::Game()
-    : m_Camera(60.0f, 1280.0f / 720.0f, 0.1f, 1000.0f) //
+    : m_Camera(60.0f, 1280.0f / 720.0f, 0.1f, Constants::HORIZON_DISTANCE * 1.5f) // Plan lointain au-delà de l'horizon
 {
     InitializeEngineSystems();
     InitializeGameObjects();
@@ -50,6 +50,7 @@ void Game::InitializeEngineSystems() {
     glfwFocusWindow(m_Window->GetGLFWWindow());
 
     m_Renderer = std::make_unique<NihilEngine::Renderer>(); //
+    m_Renderer->SetVoxelChunkSize(Constants::CHUNK_SIZE);
 
     NihilEngine::Input::Init(m_Window->GetGLFWWindow()); //
     m_Window->SetCamera(&m_Camera);
@@ -179,6 +180,11 @@ void Game::ProcessInput(float deltaTime) {
     if (NihilEngine::Input::IsKeyTriggered(GLFW_KEY_F3)) m_DebugOverlay->ToggleDebugInfo(); //
     if (NihilEngine::Input::IsKeyTriggered(GLFW_KEY_F4)) m_Player->ToggleRaycastVis(); //
     if (NihilEngine::Input::IsKeyTriggered(GLFW_KEY_F6)) m_DebugOverlay->TogglePerformance(); //
+    if (NihilEngine::Input::IsKeyTriggered(GLFW_KEY_F7)) {
+        // Bascule entre le mesher glouton et le mesher par face (comparaison A/B)
+        MeshingMode mode = m_VoxelWorld->GetMeshingMode() == MeshingMode::Greedy ? MeshingMode::PerFace : MeshingMode::Greedy;
+        m_VoxelWorld->SetMeshingMode(mode);
+    }
     if (NihilEngine::Input::IsKeyTriggered(GLFW_KEY_F5)) {
         std::cout << "[Game] Sauvegarde manuelle du monde..." << std::endl;
         // La sauvegarde automatique se fait déjà dans UpdateDirtyChunks, mais on peut forcer
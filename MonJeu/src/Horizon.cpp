@@ -0,0 +1,185 @@
+// src/Horizon.cpp
+#include <MonJeu/Horizon.h>
+#include <MonJeu/Chunk.h>
+#include <NihilEngine/Renderer.h>
+#include <NihilEngine/Camera.h>
+#include <NihilEngine/GridMath.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace MonJeu {
+
+namespace {
+    const int CHUNKS_PER_TILE = Horizon::TILE_SIZE / Chunk::SIZE;
+
+    // Position : 3, normale : 3, couleur : 4
+    const std::vector<NihilEngine::VertexAttribute> HORIZON_VERTEX_ATTRIBUTES = {
+        NihilEngine::VertexAttribute::Position,
+        NihilEngine::VertexAttribute::Normal,
+        NihilEngine::VertexAttribute::Color
+    };
+}
+
+Horizon::Horizon(NihilEngine::ProceduralGenerator& generator, NihilEngine::ChunkDataCache& cache)
+    : m_Generator(generator), m_Cache(cache) {}
+
+void Horizon::Update(const glm::vec3& cameraPosition, float innerRadius, double currentTime) {
+    int tileX = NihilEngine::FloorDiv(static_cast<int>(std::floor(cameraPosition.x)), TILE_SIZE);
+    int tileZ = NihilEngine::FloorDiv(static_cast<int>(std::floor(cameraPosition.z)), TILE_SIZE);
+    if (m_InnerRadius == innerRadius && tileX == m_CenterTileX && tileZ == m_CenterTileZ) return;
+
+    m_CenterTileX = tileX;
+    m_CenterTileZ = tileZ;
+    m_InnerRadius = innerRadius;
+    Rebuild(cameraPosition, currentTime);
+}
+
+void Horizon::Render(NihilEngine::Renderer& renderer, const NihilEngine::Camera& camera) const {
+    if (m_Entity && m_TriangleCount > 0) {
+        renderer.DrawEntity(*m_Entity, camera);
+    }
+}
+
+const NihilEngine::SimplifiedChunkData& Horizon::GetTileSummary(int tileX, int tileZ, double currentTime) {
+    int chunkX = tileX * CHUNKS_PER_TILE;
+    int chunkZ = tileZ * CHUNKS_PER_TILE;
+
+    const NihilEngine::SimplifiedChunkData* cached = m_Cache.getChunkData(chunkX, chunkZ);
+    if (cached && cached->scale.x == static_cast<float>(TILE_SIZE)) {
+        NihilEngine::SimplifiedChunkData data = *cached;
+        data.lastUpdateTime = currentTime;
+        m_Cache.updateChunkData(chunkX, chunkZ, data);
+        return *m_Cache.getChunkData(chunkX, chunkZ);
+    }
+
+    // Hauteurs et biomes sur une grille clairsemée (centres des cellules), biome dominant pour la couleur
+    const int samples = Constants::HORIZON_SAMPLES;
+    const float step = static_cast<float>(TILE_SIZE) / samples;
+    const float originX = static_cast<float>(tileX * TILE_SIZE) + step * 0.5f;
+    const float originZ = static_cast<float>(tileZ * TILE_SIZE) + step * 0.5f;
+
+    std::array<float, samples * samples> heights;
+    std::array<NihilEngine::BiomeType, samples * samples> biomes;
+    // Octaves plus fins que l'espacement des échantillons ignorés : invisibles à cette distance
+    m_Generator.getTerrainGenerator().getHeightRegion(heights.data(), samples, samples, samples, originX, originZ, step, step);
+    m_Generator.getBiomeGenerator().getBiomeRegion(biomes.data(), samples, samples, samples, originX, originZ, step,
+                                                   heights.data(), samples);
+
+    NihilEngine::SimplifiedChunkData data = m_Cache.generateSimplifiedData(chunkX, chunkZ, heights.data(), samples,
+                                                                           biomes.data(), samples, samples, samples);
+    data.scale = glm::vec3(static_cast<float>(TILE_SIZE), std::max(data.maxHeight - data.minHeight, 1.0f), static_cast<float>(TILE_SIZE));
+    data.lastUpdateTime = currentTime;
+
+    // Même correspondance que les chunks (Chunk::convertBiomeType) : les biomes sans équivalent sont des plaines
+    NihilEngine::BiomeType biome = static_cast<NihilEngine::BiomeType>(data.dominantBiome);
+    switch (biome) {
+        case NihilEngine::BiomeType::Plains:
+        case NihilEngine::BiomeType::Forest:
+        case NihilEngine::BiomeType::Desert:
+        case NihilEngine::BiomeType::Tundra:
+        case NihilEngine::BiomeType::Swamp:
+            break;
+        default:
+            biome = NihilEngine::BiomeType::Plains;
+            break;
+    }
+    data.color = m_Generator.getBiomeGenerator().getBiomeProperties(biome).grassColor;
+
+    m_Cache.updateChunkData(chunkX, chunkZ, data);
+    return *m_Cache.getChunkData(chunkX, chunkZ);
+}
+
+void Horizon::Rebuild(const glm::vec3& cameraPosition, double currentTime) {
+    const int radiusTiles = static_cast<int>(std::ceil(Constants::HORIZON_DISTANCE / TILE_SIZE));
+    const int tilesPerSide = 2 * radiusTiles + 1;
+    const int cornersPerSide = tilesPerSide + 1;
+    const int firstTileX = m_CenterTileX - radiusTiles;
+    const int firstTileZ = m_CenterTileZ - radiusTiles;
+
+    // 1. Résumés de toute la grille (y compris sous les voxels : ils donnent le bord intérieur)
+    std::vector<float> tileHeights(tilesPerSide * tilesPerSide);
+    std::vector<glm::vec3> tileColors(tilesPerSide * tilesPerSide);
+    for (int z = 0; z < tilesPerSide; ++z) {
+        for (int x = 0; x < tilesPerSide; ++x) {
+            const NihilEngine::SimplifiedChunkData& data = GetTileSummary(firstTileX + x, firstTileZ + z, currentTime);
+            tileHeights[x + z * tilesPerSide] = data.averageHeight;
+            tileColors[x + z * tilesPerSide] = data.color;
+        }
+    }
+
+    // 2. Coins partagés : moyenne des tuiles adjacentes, abaissés pour rester sous le terrain voxel
+    std::vector<float> cornerHeights(cornersPerSide * cornersPerSide);
+    std::vector<glm::vec3> cornerColors(cornersPerSide * cornersPerSide);
+    for (int z = 0; z < cornersPerSide; ++z) {
+        for (int x = 0; x < cornersPerSide; ++x) {
+            float height = 0.0f;
+            glm::vec3 color(0.0f);
+            int count = 0;
+            for (int tz = std::max(z - 1, 0); tz <= std::min(z, tilesPerSide - 1); ++tz) {
+                for (int tx = std::max(x - 1, 0); tx <= std::min(x, tilesPerSide - 1); ++tx) {
+                    height += tileHeights[tx + tz * tilesPerSide];
+                    color += tileColors[tx + tz * tilesPerSide];
+                    ++count;
+                }
+            }
+            cornerHeights[x + z * cornersPerSide] = height / count - Constants::HORIZON_DROP;
+            cornerColors[x + z * cornersPerSide] = color / static_cast<float>(count);
+        }
+    }
+
+    std::vector<float> vertices;
+    vertices.reserve(cornersPerSide * cornersPerSide * 10);
+    for (int z = 0; z < cornersPerSide; ++z) {
+        for (int x = 0; x < cornersPerSide; ++x) {
+            // Normale par différences centrées sur les coins voisins
+            auto heightAt = [&](int cx, int cz) {
+                cx = std::clamp(cx, 0, cornersPerSide - 1);
+                cz = std::clamp(cz, 0, cornersPerSide - 1);
+                return cornerHeights[cx + cz * cornersPerSide];
+            };
+            glm::vec3 normal = glm::normalize(glm::vec3(
+                heightAt(x - 1, z) - heightAt(x + 1, z),
+                2.0f * TILE_SIZE,
+                heightAt(x, z - 1) - heightAt(x, z + 1)
+            ));
+            const glm::vec3& color = cornerColors[x + z * cornersPerSide];
+
+            vertices.insert(vertices.end(), {
+                static_cast<float>((firstTileX + x) * TILE_SIZE), cornerHeights[x + z * cornersPerSide], static_cast<float>((firstTileZ + z) * TILE_SIZE),
+                normal.x, normal.y, normal.z,
+                color.x, color.y, color.z, 1.0f
+            });
+        }
+    }
+
+    // 3. Deux triangles par tuile de l'anneau : au-delà des voxels (demi-tuile de recouvrement) et dans l'horizon
+    const float innerDist = std::max(m_InnerRadius - TILE_SIZE * 0.5f, 0.0f);
+    const float outerDist = Constants::HORIZON_DISTANCE;
+    std::vector<unsigned int> indices;
+    for (int z = 0; z < tilesPerSide; ++z) {
+        for (int x = 0; x < tilesPerSide; ++x) {
+            float dx = (firstTileX + x + 0.5f) * TILE_SIZE - cameraPosition.x;
+            float dz = (firstTileZ + z + 0.5f) * TILE_SIZE - cameraPosition.z;
+            float distSq = dx * dx + dz * dz;
+            if (distSq <= innerDist * innerDist || distSq > outerDist * outerDist) continue;
+
+            unsigned int x0z0 = x + z * cornersPerSide;
+            unsigned int x1z0 = x0z0 + 1;
+            unsigned int x0z1 = x0z0 + cornersPerSide;
+            unsigned int x1z1 = x0z1 + 1;
+            indices.insert(indices.end(), {x0z1, x1z1, x1z0, x1z0, x0z0, x0z1});
+        }
+    }
+
+    m_TriangleCount = static_cast<int>(indices.size() / 3);
+    NihilEngine::Mesh mesh(vertices, indices, HORIZON_VERTEX_ATTRIBUTES);
+    if (m_Entity) {
+        m_Entity->SetMesh(std::move(mesh));
+    } else {
+        m_Entity = std::make_unique<NihilEngine::Entity>(std::move(mesh));
+    }
+}
+
+} // namespace MonJeu
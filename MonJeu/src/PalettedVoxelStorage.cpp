@@ -0,0 +1,126 @@
+// src/PalettedVoxelStorage.cpp
+#include <MonJeu/PalettedVoxelStorage.h>
+#include <algorithm>
+#include <stdexcept>
+
+namespace MonJeu {
+
+PalettedVoxelStorage::PalettedVoxelStorage(size_t voxelCount, uint8_t fillValue)
+    : m_VoxelCount(voxelCount) {
+    Fill(fillValue);
+}
+
+void PalettedVoxelStorage::Fill(uint8_t value) {
+    m_Palette.assign(1, value);
+    m_Words.clear();
+    m_Words.shrink_to_fit();
+    m_BitsPerEntry = 0;
+    m_EntryMask = 0;
+}
+
+void PalettedVoxelStorage::Set(size_t index, uint8_t value) {
+    // Chemin rapide : la valeur est déjà stockée (cas fréquent pour l'air)
+    if (Get(index) == value) return;
+
+    uint32_t entry = FindOrAddPaletteEntry(value);
+    SetEntry(index, entry);
+}
+
+void PalettedVoxelStorage::Compact() {
+    if (m_BitsPerEntry == 0) return;
+
+    std::vector<bool> used(m_Palette.size(), false);
+    for (size_t i = 0; i < m_VoxelCount; ++i) {
+        used[GetEntry(i)] = true;
+    }
+
+    std::vector<uint8_t> palette;
+    std::vector<uint32_t> remap(m_Palette.size(), 0);
+    for (size_t entry = 0; entry < m_Palette.size(); ++entry) {
+        if (!used[entry]) continue;
+        remap[entry] = static_cast<uint32_t>(palette.size());
+        palette.push_back(m_Palette[entry]);
+    }
+
+    if (palette.size() == m_Palette.size()) return;
+    if (palette.size() == 1) {
+        Fill(palette[0]);
+        return;
+    }
+
+    int newBitsPerEntry = BitsForPaletteSize(palette.size());
+    size_t wordCount = (m_VoxelCount * newBitsPerEntry + 63) / 64;
+    std::vector<uint64_t> newWords(wordCount, 0);
+
+    for (size_t i = 0; i < m_VoxelCount; ++i) {
+        uint64_t entry = remap[GetEntry(i)];
+        size_t bitIndex = i * newBitsPerEntry;
+        newWords[bitIndex >> 6] |= entry << (bitIndex & 63);
+    }
+
+    m_Palette = std::move(palette);
+    m_Words = std::move(newWords);
+    m_BitsPerEntry = newBitsPerEntry;
+    m_EntryMask = (uint64_t(1) << newBitsPerEntry) - 1;
+}
+
+size_t PalettedVoxelStorage::GetMemoryUsage() const {
+    return m_Palette.capacity() * sizeof(uint8_t) + m_Words.capacity() * sizeof(uint64_t);
+}
+
+uint32_t PalettedVoxelStorage::GetEntry(size_t index) const {
+    if (m_BitsPerEntry == 0) return 0;
+    size_t bitIndex = index * m_BitsPerEntry;
+    return static_cast<uint32_t>((m_Words[bitIndex >> 6] >> (bitIndex & 63)) & m_EntryMask);
+}
+
+void PalettedVoxelStorage::SetEntry(size_t index, uint32_t entry) {
+    size_t bitIndex = index * m_BitsPerEntry;
+    uint64_t& word = m_Words[bitIndex >> 6];
+    int shift = static_cast<int>(bitIndex & 63);
+    word = (word & ~(m_EntryMask << shift)) | (static_cast<uint64_t>(entry) << shift);
+}
+
+uint32_t PalettedVoxelStorage::FindOrAddPaletteEntry(uint8_t value) {
+    auto it = std::find(m_Palette.begin(), m_Palette.end(), value);
+    if (it != m_Palette.end()) {
+        return static_cast<uint32_t>(it - m_Palette.begin());
+    }
+
+    if (m_Palette.size() >= 256) {
+        throw std::runtime_error("PalettedVoxelStorage: palette pleine (256 types)");
+    }
+
+    m_Palette.push_back(value);
+    int requiredBits = BitsForPaletteSize(m_Palette.size());
+    if (requiredBits != m_BitsPerEntry) {
+        Repack(requiredBits);
+    }
+    return static_cast<uint32_t>(m_Palette.size() - 1);
+}
+
+void PalettedVoxelStorage::Repack(int newBitsPerEntry) {
+    // Les largeurs sont des puissances de deux : une entrée ne chevauche jamais deux mots
+    size_t wordCount = (m_VoxelCount * newBitsPerEntry + 63) / 64;
+    std::vector<uint64_t> newWords(wordCount, 0);
+
+    for (size_t i = 0; i < m_VoxelCount; ++i) {
+        uint64_t entry = GetEntry(i);
+        size_t bitIndex = i * newBitsPerEntry;
+        newWords[bitIndex >> 6] |= entry << (bitIndex & 63);
+    }
+
+    m_Words = std::move(newWords);
+    m_BitsPerEntry = newBitsPerEntry;
+    m_EntryMask = (uint64_t(1) << newBitsPerEntry) - 1;
+}
+
+int PalettedVoxelStorage::BitsForPaletteSize(size_t paletteSize) {
+    if (paletteSize <= 1) return 0;
+    if (paletteSize <= 2) return 1;
+    if (paletteSize <= 4) return 2;
+    if (paletteSize <= 16) return 4;
+    return 8;
+}
+
+} // namespace MonJeu
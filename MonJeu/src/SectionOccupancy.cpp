@@ -0,0 +1,82 @@
+// src/SectionOccupancy.cpp
+#include <MonJeu/SectionOccupancy.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define MONJEU_OCCUPANCY_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MONJEU_OCCUPANCY_SSE2
+#endif
+
+namespace MonJeu {
+
+void SectionOccupancy::Fill(bool solid) {
+    uint16_t value = solid ? 0xFFFF : 0;
+    for (Lines& lines : m_Lines) {
+        lines.fill(value);
+    }
+}
+
+void SectionOccupancy::Set(int x, int y, int z, bool solid) {
+    uint16_t* targets[3] = {
+        &m_Lines[0][y + z * SIZE],
+        &m_Lines[1][x + z * SIZE],
+        &m_Lines[2][x + y * SIZE]
+    };
+    const int bits[3] = {x, y, z};
+
+    for (int axis = 0; axis < 3; ++axis) {
+        uint16_t mask = static_cast<uint16_t>(1u << bits[axis]);
+        if (solid) {
+            *targets[axis] |= mask;
+        } else {
+            *targets[axis] &= static_cast<uint16_t>(~mask);
+        }
+    }
+}
+
+void SectionOccupancy::ExtractFaces(const Lines& lines, const Lines& neighbor, bool positive, Lines& faces) {
+    // Voisin de chaque bit : bit suivant (ou précédent) de la ligne, et bit de bord
+    // de la section adjacente pour le dernier (ou premier) voxel
+    int i = 0;
+
+#if defined(MONJEU_OCCUPANCY_AVX2)
+    for (; i + 16 <= LINE_COUNT; i += 16) {
+        __m256i own = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&lines[i]));
+        __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&neighbor[i]));
+        __m256i covered = positive
+            ? _mm256_or_si256(_mm256_srli_epi16(own, 1), _mm256_slli_epi16(next, 15))
+            : _mm256_or_si256(_mm256_slli_epi16(own, 1), _mm256_srli_epi16(next, 15));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&faces[i]), _mm256_andnot_si256(covered, own));
+    }
+#elif defined(MONJEU_OCCUPANCY_SSE2)
+    for (; i + 8 <= LINE_COUNT; i += 8) {
+        __m128i own = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&lines[i]));
+        __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&neighbor[i]));
+        __m128i covered = positive
+            ? _mm_or_si128(_mm_srli_epi16(own, 1), _mm_slli_epi16(next, 15))
+            : _mm_or_si128(_mm_slli_epi16(own, 1), _mm_srli_epi16(next, 15));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&faces[i]), _mm_andnot_si128(covered, own));
+    }
+#endif
+
+    for (; i < LINE_COUNT; ++i) {
+        uint32_t own = lines[i];
+        uint32_t next = neighbor[i];
+        uint32_t covered = positive ? ((own >> 1) | (next << 15)) : ((own << 1) | (next >> 15));
+        faces[i] = static_cast<uint16_t>(own & ~covered);
+    }
+}
+
+const SectionOccupancy::Lines& SectionOccupancy::EmptyLines() {
+    static const Lines empty = [] { Lines lines; lines.fill(0); return lines; }();
+    return empty;
+}
+
+const SectionOccupancy::Lines& SectionOccupancy::FullLines() {
+    static const Lines full = [] { Lines lines; lines.fill(0xFFFF); return lines; }();
+    return full;
+}
+
+} // namespace MonJeu
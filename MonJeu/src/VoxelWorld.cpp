@@ -3,8 +3,10 @@
 #include <MonJeu/Constants.h>
 #include <NihilEngine/Renderer.h>
 #include <NihilEngine/Camera.h>
+#include <NihilEngine/GridMath.h>
 #include <NihilEngine/Performance.h>
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 
 namespace MonJeu {
@@ -16,14 +18,30 @@ namespace MonJeu {
 // ==============================================================================
 VoxelWorld::VoxelWorld(unsigned int seed, NihilEngine::PhysicsWorld* physicsWorld, WorldSaveManager* saveManager)
     : m_ProceduralGen(seed),
+      m_ChunkDataCache(static_cast<float>(Chunk::SIZE)),
+      m_Horizon(m_ProceduralGen, m_ChunkDataCache),
       m_PhysicsWorld(physicsWorld),
       m_SaveManager(saveManager)
 {
     // Distance d'affichage
     m_DisplayDistance = 384.0f;
 
+    // Relief réparti sur la hauteur des colonnes de sections
+    m_ProceduralGen.getTerrainGenerator().setBaseHeight(static_cast<float>(Constants::BASE_HEIGHT));
+    m_ProceduralGen.getTerrainGenerator().setAmplitude(static_cast<float>(Constants::TERRAIN_AMPLITUDE));
+
     m_ProgressiveUpdate.setUpdateRate(4); // Augmenter un peu le nombre de chunks traités par frame
     m_ProgressiveUpdate.setMaxPendingUpdates(200);
+
+    // Seuils des meshes simplifiés (le détail donne la taille des cellules : 1 / détail blocs)
+    m_ChunkLOD.clearLODLevels();
+    m_ChunkLOD.addLODLevel(Constants::LOD_2X_DISTANCE, 1.0f);
+    m_ChunkLOD.addLODLevel(Constants::LOD_4X_DISTANCE, 0.5f);
+    m_ChunkLOD.addLODLevel(Constants::LOD_8X_DISTANCE, 0.25f);
+
+    if (m_SaveManager && Constants::MESH_DISK_CACHE) {
+        m_MeshCache = std::make_unique<ChunkMeshCache>(m_SaveManager->GetMeshCachePath());
+    }
 }
 
 // Génère de manière synchrone les chunks prioritaires autour d'une position (pour le spawn)
@@ -88,7 +106,12 @@ void VoxelWorld::GenerateSpawnArea(const glm::vec3& position, int radiusChunks)
         GenerateChunk(chunkX, chunkZ);
     }
 
-    std::cout << "[VoxelWorld] Spawn area generation completed." << std::endl;
+    // Meshes de la zone de spawn prêts avant la première image
+    FinishMeshJobs();
+
+    const NihilEngine::TerrainTileCache& tiles = m_ProceduralGen.getTileCache();
+    std::cout << "[VoxelWorld] Spawn area generation completed (terrain tiles: " << tiles.getCacheHits() << " hits, "
+              << tiles.getCacheMisses() << " misses)." << std::endl;
 }
 
 // Genère un chunk de voxels (Haut detail)
@@ -101,6 +124,7 @@ void VoxelWorld::GenerateChunk(int chunkX, int chunkZ) {
     // Essaie de charger le chunk depuis la sauvegarde
     if (m_SaveManager) {
         chunk = m_SaveManager->LoadChunk(chunkX, chunkZ);
+        if (chunk) m_SavedChunks.insert(key);
     }
 
     // Genère proceduralement si pas de sauvegarde
@@ -110,85 +134,357 @@ void VoxelWorld::GenerateChunk(int chunkX, int chunkZ) {
         chunk->GenerateTerrain(m_ProceduralGen);
     }
 
-    auto meshes = chunk->CreateMeshes();
-
-    // Entite principale
-    auto mainEntity = std::make_unique<NihilEngine::Entity>(
-        std::move(*meshes.mainMesh),
-        glm::vec3(chunk->GetChunkX() * Chunk::SIZE, 0.0f, chunk->GetChunkZ() * Chunk::SIZE)
-    );
-
-    // Entites d'herbe - SUPPRIMÉ : Trop lourd, à remplacer par une meilleure approche
-    // std::vector<std::unique_ptr<NihilEngine::Entity>> grassTopEntities;
-    // for (int i = 0; i < 5; ++i) {
-    //     auto grassTopEntity = std::make_unique<NihilEngine::Entity>(
-    //         std::move(*meshes.grassTopMeshes[i]),
-    //         glm::vec3(chunk->GetChunkX() * Chunk::SIZE, 0.0f, chunk->GetChunkZ() * Chunk::SIZE)
-    //     );
-    //     grassTopEntities.push_back(std::move(grassTopEntity));
-    // }
-
-    // Appliquer les materiaux (après le move)
-    if (m_TextureAtlasID != 0) {
-        NihilEngine::Material mainMaterial;
-        mainMaterial.textureID = m_TextureAtlasID;
-        mainMaterial.color = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f); // Couleur blanche neutre
-        mainEntity->SetMaterial(mainMaterial);
+    m_Chunks[key] = std::move(chunk);
+    m_ChunkLODLevels[key] = ComputeChunkLODLevel(chunkX, chunkZ, -1);
 
-        // for (int i = 0; i < 5; ++i) {
-        //     NihilEngine::Material grassTopMaterial;
-        //     grassTopMaterial.textureID = m_TextureAtlasID;
-        //     // OPTIMISATION : Couleur par défaut unique pour toute l'herbe (au lieu de 5 couleurs de biome)
-        //     grassTopMaterial.color = glm::vec4(0.4f, 0.8f, 0.2f, 1.0f); // Vert d'herbe standard
-        //     grassTopEntities[i]->SetMaterial(grassTopMaterial);
-        // }
-    }
+    // Mesh construit par les threads de travail : l'entité est créée à la réception (ApplyMeshResults)
+    RequestChunkMesh(key);
 
-    m_Chunks[key] = std::move(chunk);
-    m_ChunkEntities[key] = std::move(mainEntity);
-    // for (int i = 0; i < 5; ++i) {
-    //     m_GrassTopEntities[i][key] = std::move(grassTopEntities[i]);
-    // }
+    // Les voisins déjà chargés peuvent maintenant cacher leurs faces de bordure
+    QueueNeighborRemesh(chunkX, chunkZ);
 }
 
 void VoxelWorld::UpdateDirtyChunks() {
-    // [Logique de UpdateDirtyChunks - Inchangee]
+    // Meshes terminés par les threads de travail : création des objets GL sur ce thread
+    ApplyMeshResults();
+    ApplyMergeResults();
+
     std::sort(m_DirtyChunks.begin(), m_DirtyChunks.end());
     m_DirtyChunks.erase(std::unique(m_DirtyChunks.begin(), m_DirtyChunks.end()), m_DirtyChunks.end());
 
     for (uint64_t key : m_DirtyChunks) {
         if (m_Chunks.find(key) != m_Chunks.end()) {
             const Chunk& chunk = *m_Chunks[key];
-            auto meshes = chunk.CreateMeshes();
-
-            m_ChunkEntities[key]->SetMesh(std::move(*meshes.mainMesh));
+            RequestChunkMesh(key);
             // for (int i = 0; i < 5; ++i) {
             //     m_GrassTopEntities[i][key]->SetMesh(std::move(*meshes.grassTopMeshes[i]));
             // } - COMMENTE: suppression du système d'entités d'herbe
 
-            if (m_TextureAtlasID != 0) {
-                NihilEngine::Material mainMaterial;
-                mainMaterial.textureID = m_TextureAtlasID;
-                mainMaterial.color = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-                m_ChunkEntities[key]->SetMaterial(mainMaterial);
-
-                // for (int i = 0; i < 5; ++i) {
-                //     NihilEngine::Material grassTopMaterial;
-                //     grassTopMaterial.textureID = m_TextureAtlasID;
-                //     const Constants::Biome& biomeData = Constants::BIOMES[i];
-                //     grassTopMaterial.color = glm::vec4(biomeData.grassColor, 1.0f);
-                //     m_GrassTopEntities[i][key]->SetMaterial(grassTopMaterial);
-                // } - COMMENTE: suppression du système d'entités d'herbe
-            }
-
             // Sauvegarde automatique du chunk modifie
             if (m_SaveManager) {
                 m_SaveManager->SaveChunk(chunk);
+                m_SavedChunks.insert(key);
                 std::cout << "[VoxelWorld] Chunk sauvegarde: (" << chunk.GetChunkX() << ", " << chunk.GetChunkZ() << ")" << std::endl;
             }
         }
     }
+
+    // Remesh des bordures sans sauvegarde (les chunks déjà reconstruits ci-dessus sont ignorés)
+    std::sort(m_RemeshChunks.begin(), m_RemeshChunks.end());
+    m_RemeshChunks.erase(std::unique(m_RemeshChunks.begin(), m_RemeshChunks.end()), m_RemeshChunks.end());
+    for (uint64_t key : m_RemeshChunks) {
+        if (!std::binary_search(m_DirtyChunks.begin(), m_DirtyChunks.end(), key)) {
+            RequestChunkMesh(key);
+        }
+    }
+
     m_DirtyChunks.clear();
+    m_RemeshChunks.clear();
+}
+
+size_t VoxelWorld::RebuildChunkMesh(uint64_t key) {
+    auto chunkIt = m_Chunks.find(key);
+    if (chunkIt == m_Chunks.end()) return 0;
+
+    Chunk& chunk = *chunkIt->second;
+    int lodScale = GetChunkLODScale(key);
+    ChunkNeighbors neighbors = GetNeighbors(chunk.GetChunkX(), chunk.GetChunkZ(), lodScale);
+    auto data = std::make_shared<ChunkMeshData>(lodScale > 1
+        ? chunk.BuildLODMeshData(neighbors, lodScale)
+        : chunk.BuildMeshData(neighbors, m_MeshingMode));
+    size_t indexCount = data->vertices.size() / 4 * 6;
+    ApplyChunkMeshes(key, std::move(data));
+    return indexCount;
+}
+
+void VoxelWorld::RequestChunkMesh(uint64_t key) {
+    auto chunkIt = m_Chunks.find(key);
+    if (chunkIt == m_Chunks.end()) return;
+
+    // Un seul meshing en cours par chunk : les demandes suivantes sont regroupées
+    if (m_MeshJobs.find(key) != m_MeshJobs.end()) {
+        m_RemeshAfterJob.insert(key);
+        return;
+    }
+
+    Chunk& chunk = *chunkIt->second;
+    AsyncChunkMesher::Job job{key, m_NextMeshTicket++, chunk.TakeMeshingSnapshot(), {}, m_MeshingMode};
+    job.lodScale = GetChunkLODScale(key);
+    if (job.lodScale == 1 && m_SavedChunks.count(key) > 0) job.diskCache = m_MeshCache.get();
+
+    ChunkNeighbors neighbors = GetNeighbors(chunk.GetChunkX(), chunk.GetChunkZ(), job.lodScale);
+    const Chunk* neighborChunks[4] = {neighbors.posX, neighbors.negX, neighbors.posZ, neighbors.negZ};
+    job.neighborScales = {neighbors.posXScale, neighbors.negXScale, neighbors.posZScale, neighbors.negZScale};
+    for (int i = 0; i < 4; ++i) {
+        if (neighborChunks[i]) job.neighbors[i].emplace(*neighborChunks[i]);
+    }
+
+    m_MeshJobs[key] = job.ticket;
+    m_Mesher.Submit(std::move(job));
+}
+
+void VoxelWorld::ApplyMeshResults() {
+    m_MeshResults.clear();
+    m_Mesher.CollectResults(m_MeshResults);
+
+    for (AsyncChunkMesher::Result& result : m_MeshResults) {
+        // Résultat d'un chunk déchargé entre-temps : ignoré
+        auto jobIt = m_MeshJobs.find(result.key);
+        if (jobIt == m_MeshJobs.end() || jobIt->second != result.ticket) continue;
+        m_MeshJobs.erase(jobIt);
+
+        m_Chunks[result.key]->AdoptMeshCache(result.chunk);
+        ApplyChunkMeshes(result.key, std::make_shared<ChunkMeshData>(std::move(result.data)));
+
+        if (m_RemeshAfterJob.erase(result.key) > 0) {
+            RequestChunkMesh(result.key);
+        }
+    }
+    m_MeshResults.clear();
+}
+
+void VoxelWorld::FinishMeshJobs() {
+    while (!m_MeshJobs.empty()) {
+        m_Mesher.WaitIdle();
+        ApplyMeshResults();
+    }
+}
+
+void VoxelWorld::ApplyChunkMeshes(uint64_t key, std::shared_ptr<ChunkMeshData> data) {
+    ChunkMeshes meshes = Chunk::UploadMeshData(*data);
+    std::shared_ptr<ChunkMeshData>& current = m_ChunkMeshData[key];
+    RecycleMeshData(std::move(current));
+    current = std::move(data);
+
+    // Le super-chunk est redessiné chunk par chunk jusqu'à sa prochaine fusion
+    const Chunk& chunk = *m_Chunks[key];
+    MarkSuperChunkDirty(chunk.GetChunkX(), chunk.GetChunkZ());
+
+    auto entityIt = m_ChunkEntities.find(key);
+    if (entityIt != m_ChunkEntities.end()) {
+        entityIt->second->SetMesh(std::move(*meshes.mainMesh));
+        return;
+    }
+
+    // Premier mesh du chunk : création de l'entité
+    m_ChunkEntities[key] = CreateChunkEntity(
+        std::move(*meshes.mainMesh),
+        glm::vec3(chunk.GetChunkX() * Chunk::SIZE, 0.0f, chunk.GetChunkZ() * Chunk::SIZE)
+    );
+}
+
+void VoxelWorld::RecycleMeshData(std::shared_ptr<ChunkMeshData> data) {
+    if (!data || data.use_count() != 1) return;
+
+    // Une fusion qui vient de relâcher le mesh sur un autre thread a fini de le lire
+    std::atomic_thread_fence(std::memory_order_acquire);
+    ChunkMeshBuilder::Recycle(std::move(data->vertices));
+}
+
+std::unique_ptr<NihilEngine::Entity> VoxelWorld::CreateChunkEntity(NihilEngine::Mesh&& mesh, const glm::vec3& position) const {
+    auto mainEntity = std::make_unique<NihilEngine::Entity>(std::move(mesh), position);
+
+    if (m_TextureAtlasID != 0) {
+        NihilEngine::Material mainMaterial;
+        mainMaterial.textureID = m_TextureAtlasID;
+        mainMaterial.color = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f); // Couleur blanche neutre
+        mainEntity->SetMaterial(mainMaterial);
+    }
+    return mainEntity;
+}
+
+int VoxelWorld::ComputeChunkLODLevel(int chunkX, int chunkZ, int currentLevel) const {
+    // Distance horizontale : la colonne couvre toute la hauteur du monde, le chunk sous la caméra
+    // reste au niveau 0 quelle que soit l'altitude
+    glm::vec2 chunkCenter(chunkX * Chunk::SIZE + Chunk::SIZE / 2.0f, chunkZ * Chunk::SIZE + Chunk::SIZE / 2.0f);
+    float distance = glm::distance(glm::vec2(m_LODCameraPosition.x, m_LODCameraPosition.z), chunkCenter);
+    return m_ChunkLOD.getLevelIndex(distance, currentLevel, Constants::LOD_HYSTERESIS);
+}
+
+int VoxelWorld::GetChunkLODScale(uint64_t key) const {
+    auto levelIt = m_ChunkLODLevels.find(key);
+    if (levelIt == m_ChunkLODLevels.end()) return 1;
+
+    // Puissance de deux la plus proche de 1 / détail, limitée à 8 (cellules d'un demi-chunk)
+    float detail = m_ChunkLOD.getLevelDetail(levelIt->second);
+    int scale = 1;
+    while (scale < 8 && scale * detail < 0.75f) {
+        scale *= 2;
+    }
+    return scale;
+}
+
+void VoxelWorld::MarkSuperChunkDirty(int chunkX, int chunkZ) {
+    uint64_t groupKey = GetSuperChunkKey(chunkX, chunkZ);
+    SuperChunk& superChunk = m_SuperChunks[groupKey];
+    superChunk.upToDate = false;
+    superChunk.pendingTicket = 0; // Une fusion en cours est déjà périmée : son résultat sera ignoré
+    m_DirtySuperChunks.insert(groupKey);
+}
+
+void VoxelWorld::UpdateSuperChunks(const glm::vec3& cameraPosition) {
+    for (auto it = m_DirtySuperChunks.begin(); it != m_DirtySuperChunks.end(); ) {
+        uint64_t groupKey = *it;
+        int32_t groupX = (groupKey >> 32);
+        int32_t groupZ = (groupKey & 0xFFFFFFFF);
+
+        AsyncChunkMesher::MergeJob job{groupKey, 0, {}};
+        uint8_t members = 0;
+        for (int slot = 0; slot < 4; ++slot) {
+            auto dataIt = m_ChunkMeshData.find(GetChunkKey(groupX * 2 + slot % 2, groupZ * 2 + slot / 2));
+            if (dataIt == m_ChunkMeshData.end()) continue;
+            job.members[slot] = dataIt->second;
+            members |= static_cast<uint8_t>(1u << slot);
+        }
+
+        // Tous les chunks du groupe ont été déchargés
+        if (members == 0) {
+            m_SuperChunks.erase(groupKey);
+            it = m_DirtySuperChunks.erase(it);
+            continue;
+        }
+
+        // De près les chunks sont dessinés séparément (et au-delà de l'affichage, bientôt déchargés) :
+        // fusion reportée jusqu'à ce que le groupe soit dans l'anneau lointain
+        if (!IsInSuperChunkRing(groupX, groupZ, cameraPosition)) {
+            ++it;
+            continue;
+        }
+
+        SuperChunk& superChunk = m_SuperChunks[groupKey];
+        job.ticket = m_NextMeshTicket++;
+        superChunk.pendingTicket = job.ticket;
+        superChunk.pendingMembers = members;
+        m_Mesher.SubmitMerge(std::move(job));
+        it = m_DirtySuperChunks.erase(it);
+    }
+}
+
+bool VoxelWorld::IsInSuperChunkRing(int groupX, int groupZ, const glm::vec3& cameraPosition) const {
+    glm::vec3 groupCenter((groupX * 2 + 1) * Chunk::SIZE, 0.0f, (groupZ * 2 + 1) * Chunk::SIZE);
+    // Anneau proche mesuré à l'horizontale : en altitude, les groupes sous le joueur (où il modifie
+    // des blocs) restent dessinés chunk par chunk
+    float horizontalDistance = glm::distance(glm::vec2(cameraPosition.x, cameraPosition.z), glm::vec2(groupCenter.x, groupCenter.z));
+    // Limite d'affichage identique à celle des chunks seuls (Render)
+    float distance = glm::length(cameraPosition - groupCenter);
+    return horizontalDistance > m_SuperChunkDistance && distance <= m_DisplayDistance;
+}
+
+void VoxelWorld::ApplyMergeResults() {
+    m_MergeResults.clear();
+    m_Mesher.CollectMergeResults(m_MergeResults);
+
+    for (AsyncChunkMesher::MergeResult& result : m_MergeResults) {
+        // Groupe modifié ou déchargé depuis la soumission : une fusion plus récente suivra
+        auto superIt = m_SuperChunks.find(result.key);
+        if (superIt == m_SuperChunks.end() || superIt->second.pendingTicket != result.ticket) continue;
+
+        SuperChunk& superChunk = superIt->second;
+        ChunkMeshes meshes = Chunk::UploadMeshData(result.data);
+        if (superChunk.entity) {
+            superChunk.entity->SetMesh(std::move(*meshes.mainMesh));
+        } else {
+            int32_t groupX = (result.key >> 32);
+            int32_t groupZ = (result.key & 0xFFFFFFFF);
+            superChunk.entity = CreateChunkEntity(
+                std::move(*meshes.mainMesh),
+                glm::vec3(groupX * 2 * Chunk::SIZE, 0.0f, groupZ * 2 * Chunk::SIZE)
+            );
+        }
+        superChunk.faceRanges = meshes.faceRanges;
+        superChunk.minY = meshes.minY;
+        superChunk.maxY = meshes.maxY;
+        superChunk.members = superChunk.pendingMembers;
+        superChunk.pendingTicket = 0;
+        superChunk.upToDate = true;
+    }
+    m_MergeResults.clear();
+}
+
+const Chunk* VoxelWorld::FindChunk(int chunkX, int chunkZ) const {
+    auto it = m_Chunks.find(GetChunkKey(chunkX, chunkZ));
+    return it != m_Chunks.end() ? it->second.get() : nullptr;
+}
+
+ChunkNeighbors VoxelWorld::GetNeighbors(int chunkX, int chunkZ, int scale) const {
+    auto neighbor = [&](int offsetX, int offsetZ, const Chunk*& chunk, int& neighborScale) {
+        neighborScale = GetChunkLODScale(GetChunkKey(chunkX + offsetX, chunkZ + offsetZ));
+        chunk = (scale == 1 && neighborScale > 1) ? nullptr : FindChunk(chunkX + offsetX, chunkZ + offsetZ);
+    };
+
+    ChunkNeighbors neighbors;
+    neighbor(1, 0, neighbors.posX, neighbors.posXScale);
+    neighbor(-1, 0, neighbors.negX, neighbors.negXScale);
+    neighbor(0, 1, neighbors.posZ, neighbors.posZScale);
+    neighbor(0, -1, neighbors.negZ, neighbors.negZScale);
+    return neighbors;
+}
+
+void VoxelWorld::QueueNeighborRemesh(int chunkX, int chunkZ) {
+    const int offsets[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+    for (const auto& offset : offsets) {
+        uint64_t neighborKey = GetChunkKey(chunkX + offset[0], chunkZ + offset[1]);
+        auto it = m_Chunks.find(neighborKey);
+        if (it != m_Chunks.end()) {
+            it->second->MarkAllSectionsDirty();
+            m_RemeshChunks.push_back(neighborKey);
+        }
+    }
+}
+
+void VoxelWorld::QueueNeighborSectionRemesh(int chunkX, int chunkZ, int sectionY) {
+    uint64_t key = GetChunkKey(chunkX, chunkZ);
+    auto it = m_Chunks.find(key);
+    if (it == m_Chunks.end()) return;
+
+    it->second->MarkSectionDirty(sectionY);
+    m_RemeshChunks.push_back(key);
+}
+
+void VoxelWorld::SetMeshingMode(MeshingMode mode) {
+    if (mode == m_MeshingMode) return;
+    m_MeshingMode = mode;
+
+    // Reconstruction immédiate de tous les chunks chargés : outil de debug, le pic est acceptable
+    FinishMeshJobs();
+    size_t totalIndices = 0;
+    for (const auto& entry : m_Chunks) {
+        totalIndices += RebuildChunkMesh(entry.first);
+    }
+
+    std::cout << "[VoxelWorld] Meshing mode: " << (m_MeshingMode == MeshingMode::Greedy ? "greedy" : "per-face")
+              << " (" << totalIndices / 3 << " triangles)" << std::endl;
+}
+
+namespace {
+    // Plages des directions de face visibles depuis la caméra, les plages adjacentes fusionnées.
+    // Une direction n'est visible que si la caméra est devant au moins un de ses plans :
+    // ils sont bornés par l'AABB du mesh (ex. -Y ignoré sous les yeux)
+    size_t CollectVisibleRanges(const std::array<NihilEngine::MeshRange, 6>& faceRanges,
+                                const glm::vec3& boundsMin, const glm::vec3& boundsMax,
+                                const glm::vec3& camPos, NihilEngine::MeshRange ranges[6]) {
+        const bool faceVisible[6] = {
+            camPos.z > boundsMin.z, // +Z
+            camPos.z < boundsMax.z, // -Z
+            camPos.x < boundsMax.x, // -X
+            camPos.x > boundsMin.x, // +X
+            camPos.y > boundsMin.y, // +Y
+            camPos.y < boundsMax.y  // -Y
+        };
+
+        size_t rangeCount = 0;
+        for (int face = 0; face < 6; ++face) {
+            const NihilEngine::MeshRange& range = faceRanges[face];
+            if (!faceVisible[face] || range.indexCount == 0) continue;
+
+            if (rangeCount > 0 && ranges[rangeCount - 1].firstIndex + ranges[rangeCount - 1].indexCount == range.firstIndex) {
+                ranges[rangeCount - 1].indexCount += range.indexCount;
+            } else {
+                ranges[rangeCount++] = range;
+            }
+        }
+        return rangeCount;
+    }
 }
 
 void VoxelWorld::Render(NihilEngine::Renderer& renderer, const NihilEngine::Camera& camera) {
@@ -199,18 +495,61 @@ void VoxelWorld::Render(NihilEngine::Renderer& renderer, const NihilEngine::Came
 
     // Mesurer le rendu des entités principales
     NihilEngine::PerformanceMonitor::getInstance().startSection("Render_MainEntities");
+    NihilEngine::MeshRange ranges[6];
+
+    // Super-chunks lointains à jour : un seul appel pour leurs 2x2 chunks
+    for (auto& [groupKey, superChunk] : m_SuperChunks) {
+        superChunk.drawnMerged = false;
+        if (!superChunk.upToDate || !superChunk.entity) continue;
+
+        int32_t groupX = (groupKey >> 32);
+        int32_t groupZ = (groupKey & 0xFFFFFFFF);
+        if (!IsInSuperChunkRing(groupX, groupZ, camPos)) continue;
+
+        glm::vec3 origin = superChunk.entity->GetPosition();
+
+        superChunk.drawnMerged = true;
+        glm::vec3 boundsMin(origin.x, static_cast<float>(superChunk.minY), origin.z);
+        glm::vec3 boundsMax(origin.x + 2 * Chunk::SIZE, static_cast<float>(superChunk.maxY), origin.z + 2 * Chunk::SIZE);
+        size_t rangeCount = CollectVisibleRanges(superChunk.faceRanges, boundsMin, boundsMax, camPos, ranges);
+        renderer.DrawEntity(*superChunk.entity, camera, ranges, rangeCount);
+    }
+
     for (auto const& [key, val] : m_ChunkEntities)
     {
         glm::vec3 chunkPos = val->GetPosition() + glm::vec3(Chunk::SIZE * 0.5f, 0.0f, Chunk::SIZE * 0.5f);
         float distSq = glm::dot(camPos - chunkPos, camPos - chunkPos);
 
-        if (distSq <= maxRenderDistSq) {
+        if (distSq > maxRenderDistSq) continue;
+
+        // Déjà dessiné par son super-chunk
+        int32_t chunkX = (key >> 32);
+        int32_t chunkZ = (key & 0xFFFFFFFF);
+        auto superIt = m_SuperChunks.find(GetSuperChunkKey(chunkX, chunkZ));
+        if (superIt != m_SuperChunks.end() && superIt->second.drawnMerged &&
+            (superIt->second.members & (1u << ((chunkX & 1) + 2 * (chunkZ & 1))))) {
+            continue;
+        }
+
+        auto dataIt = m_ChunkMeshData.find(key);
+        if (dataIt == m_ChunkMeshData.end()) {
             renderer.DrawEntity(*val, camera);
+            continue;
         }
+
+        const ChunkMeshData& data = *dataIt->second;
+        glm::vec3 boundsMin(val->GetPosition().x, static_cast<float>(data.minY), val->GetPosition().z);
+        glm::vec3 boundsMax(boundsMin.x + Chunk::SIZE, static_cast<float>(data.maxY), boundsMin.z + Chunk::SIZE);
+        size_t rangeCount = CollectVisibleRanges(data.faceRanges, boundsMin, boundsMax, camPos, ranges);
+        renderer.DrawEntity(*val, camera, ranges, rangeCount);
     }
     NihilEngine::PerformanceMonitor::getInstance().endSection("Render_MainEntities");
 
     // Mesurer le rendu des entités d'herbe
+    NihilEngine::PerformanceMonitor::getInstance().startSection("Render_Horizon");
+    m_Horizon.Render(renderer, camera);
+    NihilEngine::PerformanceMonitor::getInstance().endSection("Render_Horizon");
+
     NihilEngine::PerformanceMonitor::getInstance().startSection("Render_GrassEntities");
     // SUPPRIMÉ : Système d'entités d'herbe trop lourd - à remplacer par une meilleure approche
     NihilEngine::PerformanceMonitor::getInstance().endSection("Render_GrassEntities");
@@ -241,8 +580,8 @@ bool VoxelWorld::GetVoxelActive(int worldX, int worldY, int worldZ) const {
         int localX = worldX - chunkX * Chunk::SIZE;
         int localZ = worldZ - chunkZ * Chunk::SIZE;
         int localY = worldY;
-        if (localX >= 0 && localX < Chunk::SIZE && localY >= 0 && localY < Chunk::SIZE && localZ >= 0 && localZ < Chunk::SIZE) {
-            return m_Chunks.at(key)->GetVoxel(localX, localY, localZ).active;
+        if (localX >= 0 && localX < Chunk::SIZE && localY >= 0 && localY < Chunk::HEIGHT && localZ >= 0 && localZ < Chunk::SIZE) {
+            return m_Chunks.at(key)->IsSolid(localX, localY, localZ);
         }
     }
     return false;
@@ -258,35 +597,43 @@ void VoxelWorld::SetVoxelActive(int worldX, int worldY, int worldZ, bool active)
         int localX = worldX - chunkX * Chunk::SIZE;
         int localZ = worldZ - chunkZ * Chunk::SIZE;
         int localY = worldY;
-        if (localX >= 0 && localX < Chunk::SIZE && localY >= 0 && localY < Chunk::SIZE && localZ >= 0 && localZ < Chunk::SIZE) {
-            m_Chunks[key]->GetVoxel(localX, localY, localZ).active = active;
-            if (active) {
-                m_Chunks[key]->GetVoxel(localX, localY, localZ).type = BlockType::Grass;
-            }
+        if (localX >= 0 && localX < Chunk::SIZE && localY >= 0 && localY < Chunk::HEIGHT && localZ >= 0 && localZ < Chunk::SIZE) {
+            m_Chunks[key]->SetVoxel(localX, localY, localZ, active ? BlockType::Grass : BlockType::Air);
+            m_Chunks[key]->CompactSection(localY / Chunk::SIZE); // Libère la section si elle est vidée
             m_DirtyChunks.push_back(key);
-            if (localX == 0) m_DirtyChunks.push_back(GetChunkKey(chunkX - 1, chunkZ));
-            if (localX == Chunk::SIZE - 1) m_DirtyChunks.push_back(GetChunkKey(chunkX + 1, chunkZ));
-            if (localZ == 0) m_DirtyChunks.push_back(GetChunkKey(chunkX, chunkZ - 1));
-            if (localZ == Chunk::SIZE - 1) m_DirtyChunks.push_back(GetChunkKey(chunkX, chunkZ + 1));
+            // Les voisins ne sont pas modifiés : seule la section de bordure à la même hauteur change
+            int sectionY = localY / Chunk::SIZE;
+            if (localX == 0) QueueNeighborSectionRemesh(chunkX - 1, chunkZ, sectionY);
+            if (localX == Chunk::SIZE - 1) QueueNeighborSectionRemesh(chunkX + 1, chunkZ, sectionY);
+            if (localZ == 0) QueueNeighborSectionRemesh(chunkX, chunkZ - 1, sectionY);
+            if (localZ == Chunk::SIZE - 1) QueueNeighborSectionRemesh(chunkX, chunkZ + 1, sectionY);
         }
     }
 }
 
 uint64_t VoxelWorld::GetChunkKey(int chunkX, int chunkZ) const {
-    return (static_cast<uint64_t>(static_cast<int32_t>(chunkX)) << 32) | (static_cast<uint64_t>(static_cast<int32_t>(chunkZ)) & 0xFFFFFFFF);
+    return NihilEngine::GridKey(chunkX, chunkZ);
+}
+
+uint64_t VoxelWorld::GetSuperChunkKey(int chunkX, int chunkZ) const {
+    // Le groupe (-1, -1) couvre les chunks -2 et -1
+    return GetChunkKey(NihilEngine::FloorDiv(chunkX, 2), NihilEngine::FloorDiv(chunkZ, 2));
 }
 
 bool VoxelWorld::CheckCollision(const NihilEngine::AABB& box) const {
-    // [Logique de CheckCollision - Inchangee]
     glm::ivec3 min = glm::floor(box.min);
     glm::ivec3 max = glm::floor(box.max);
 
-    for (int y = min.y; y <= max.y; ++y) {
-        for (int z = min.z; z <= max.z; ++z) {
-            for (int x = min.x; x <= max.x; ++x) {
-                if (GetVoxelActive(x, y, z)) {
-                    return true;
-                }
+    // Une requête par colonne : la plage Y est testée sur les masques d'occupation
+    for (int z = min.z; z <= max.z; ++z) {
+        for (int x = min.x; x <= max.x; ++x) {
+            int chunkX, chunkZ;
+            WorldToChunk(x, z, chunkX, chunkZ);
+            const Chunk* chunk = FindChunk(chunkX, chunkZ);
+            if (!chunk) continue;
+
+            if (chunk->IsColumnSolidInRange(x - chunkX * Chunk::SIZE, z - chunkZ * Chunk::SIZE, min.y, max.y)) {
+                return true;
             }
         }
     }
@@ -302,6 +649,7 @@ void VoxelWorld::UpdateLOD(const glm::vec3& cameraPosition, double deltaTime) {
 
     glm::vec3 camPos = cameraPosition;
     float maxRenderDistSq = m_DisplayDistance * m_DisplayDistance;
+    m_LODCameraPosition = cameraPosition;
 
     int displayDistChunks = static_cast<int>(m_DisplayDistance / Chunk::SIZE) + 1;
 
@@ -315,7 +663,7 @@ void VoxelWorld::UpdateLOD(const glm::vec3& cameraPosition, double deltaTime) {
             if (distSq <= maxRenderDistSq) {
                 uint64_t key = GetChunkKey(x, z);
 
-                if (m_ChunkEntities.find(key) == m_ChunkEntities.end()) {
+                if (m_Chunks.find(key) == m_Chunks.end()) {
                     float distance = glm::distance(glm::vec2(cameraPosition.x, cameraPosition.z), glm::vec2(chunkCenter.x, chunkCenter.z));
                     double priority = 1000.0 / (distance + 1.0);
                     m_ProgressiveUpdate.requestChunkUpdate(x, z, priority);
@@ -330,8 +678,8 @@ void VoxelWorld::UpdateLOD(const glm::vec3& cameraPosition, double deltaTime) {
             this->GenerateChunk(chunkX, chunkZ);
         });
 
-    // 3. Decharger les chunks
-    for (auto it = m_ChunkEntities.begin(); it != m_ChunkEntities.end(); ) {
+    // 3. Decharger les chunks (y compris ceux dont le premier mesh est encore en construction)
+    for (auto it = m_Chunks.begin(); it != m_Chunks.end(); ) {
         uint64_t key = it->first;
         int32_t chunkX = (key >> 32);
         int32_t chunkZ = (key & 0xFFFFFFFF);
@@ -341,17 +689,45 @@ void VoxelWorld::UpdateLOD(const glm::vec3& cameraPosition, double deltaTime) {
         float distSq = glm::dot(camPos - chunkCenter, camPos - chunkCenter);
         if (distSq > maxRenderDistSq) {
             m_ProgressiveUpdate.cancelChunkUpdate(chunkX, chunkZ);
-            m_Chunks.erase(key);
+            m_ChunkEntities.erase(key);
+            auto dataIt = m_ChunkMeshData.find(key);
+            if (dataIt != m_ChunkMeshData.end()) {
+                RecycleMeshData(std::move(dataIt->second));
+                m_ChunkMeshData.erase(dataIt);
+            }
+            MarkSuperChunkDirty(chunkX, chunkZ);
+            m_MeshJobs.erase(key); // Le résultat en cours sera ignoré
+            m_RemeshAfterJob.erase(key);
+            m_SavedChunks.erase(key);
+            m_ChunkLODLevels.erase(key);
             // for (auto& grassMap : m_GrassTopEntities) {
             //     grassMap.erase(key);
             // } - COMMENTE: suppression du système d'entités d'herbe
-            it = m_ChunkEntities.erase(it);
+            it = m_Chunks.erase(it);
+            QueueNeighborRemesh(chunkX, chunkZ);
         } else {
+            // Changement de niveau de détail : l'ancien mesh reste affiché jusqu'à la réception du nouveau
+            int& level = m_ChunkLODLevels[key];
+            int newLevel = ComputeChunkLODLevel(chunkX, chunkZ, level);
+            if (newLevel != level) {
+                int oldScale = GetChunkLODScale(key);
+                level = newLevel;
+                RequestChunkMesh(key);
+                // Les bordures des voisins sont cachées ou non selon notre échelle
+                if (GetChunkLODScale(key) != oldScale) QueueNeighborRemesh(chunkX, chunkZ);
+            }
             ++it;
         }
     }
 
-    m_ChunkDataCache.cleanupOldData(0.0, 300.0);
+    // 4. Fusionner les super-chunks lointains modifiés
+    UpdateSuperChunks(camPos);
+
+    // 5. Horizon au-delà des voxels (reconstruit seulement quand la caméra change de tuile)
+    m_WorldTime += deltaTime;
+    m_Horizon.Update(camPos, m_DisplayDistance, m_WorldTime);
+
+    m_ChunkDataCache.cleanupOldData(m_WorldTime, 300.0);
 }
 
 } // namespace MonJeu
\ No newline at end of file
@@ -194,8 +194,8 @@ std::string WorldSaveManager::GetChunkFilename(int chunkX, int chunkZ) const {
 
 std::filesystem::path WorldSaveManager::GetChunkPath(int chunkX, int chunkZ) const {
     // Organise les chunks dans des sous-dossiers pour éviter trop de fichiers dans un seul dossier
-    int folderX = chunkX / 32;  // 32 chunks par dossier
-    int folderZ = chunkZ / 32;
+    int folderX = chunkX / Constants::CHUNKS_PER_SAVE_FOLDER;
+    int folderZ = chunkZ / Constants::CHUNKS_PER_SAVE_FOLDER;
 
     std::filesystem::path chunkDir = m_WorldPath / std::to_string(folderX) / std::to_string(folderZ);
     return chunkDir / GetChunkFilename(chunkX, chunkZ);
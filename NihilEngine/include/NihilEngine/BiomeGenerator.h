@@ -1,6 +1,12 @@
 #pragma once
 
 #include <NihilEngine/Noise.h>
+#include <array>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 #include <glm/glm.hpp>
 
@@ -31,9 +37,26 @@ public:
     BiomeGenerator(unsigned int seed = 0);
     ~BiomeGenerator() = default;
 
+    // Le climat (température, humidité) est échantillonné sur un réseau de CLIMATE_CELL blocs, mis en cache
+    // par régions de CLIMATE_REGION_CELLS cellules, puis interpolé bilinéairement par colonne.
+    // Fréquence max du climat 0.004 (longueur d'onde 250 blocs) : écart médian à l'évaluation exacte ~1e-4,
+    // plus fort seulement aux sauts du Perlin existant sur son réseau entier ; ~0.14 % des colonnes changent de biome
+    static constexpr int CLIMATE_CELL = 8;
+    static constexpr int CLIMATE_REGION_CELLS = 32;
+    static constexpr size_t MAX_CLIMATE_REGIONS = 64; // 256x256 blocs par région, ~560 Ko
+
     // Détermine le biome pour une position donnée
     BiomeType getBiome(float x, float z, float height) const;
 
+    // Biomes d'un rectangle dans un tampon fourni :
+    // out[i + j * stride] = getBiome(originX + i * step, originZ + j * step, heights[i + j * heightStride]).
+    // Exception : si step >= CLIMATE_CELL (horizon, cartes grossières), le climat est évalué exactement aux
+    // échantillons, sans charger de régions, au lieu d'être interpolé. Identique à getBiome si les échantillons
+    // tombent sur les nœuds du réseau (origine et pas multiples de CLIMATE_CELL) ; sinon le biome en diffère près
+    // des frontières climatiques seulement (~0.1 à 0.3 % des colonnes)
+    void getBiomeRegion(BiomeType* out, size_t stride, int width, int depth, float originX, float originZ, float step,
+                        const float* heights, size_t heightStride) const;
+
     // Génère une carte de biomes
     std::vector<std::vector<BiomeType>> generateBiomeMap(int width, int height, float scale,
                                                          const std::vector<std::vector<float>>& heightMap) const;
@@ -41,12 +64,49 @@ public:
     // Obtient les propriétés d'un biome
     const Biome& getBiomeProperties(BiomeType type) const;
 
+    // Fonction de base des couches climatiques (température, humidité) ; Perlin par défaut
+    void setTemperatureBasis(NoiseBasis basis) { temperatureBasis = basis; clearClimateCache(); }
+    void setHumidityBasis(NoiseBasis basis) { humidityBasis = basis; clearClimateCache(); }
+
+    // Incrémentée à chaque changement de paramètre (invalidation des caches, cf. TerrainTileCache)
+    unsigned int getRevision() const { return revision; }
+
 private:
+    static constexpr int CLIMATE_REGION_NODES = CLIMATE_REGION_CELLS + 1; // Bordure incluse : une région suffit à interpoler
+
+    // Bruits climatiques bruts (dans [-1, 1]) aux nœuds d'une région
+    struct ClimateRegion {
+        std::array<float, CLIMATE_REGION_NODES * CLIMATE_REGION_NODES> temperature;
+        std::array<float, CLIMATE_REGION_NODES * CLIMATE_REGION_NODES> humidity;
+    };
+
     Noise temperatureNoise;
     Noise humidityNoise;
+    NoiseBasis temperatureBasis = NoiseBasis::Perlin;
+    NoiseBasis humidityBasis = NoiseBasis::Perlin;
     std::vector<Biome> biomes;
+    unsigned int revision = 0;
+
+    using ClimateRegionList = std::list<uint64_t>; // Plus récemment utilisée en tête
+
+    struct ClimateEntry {
+        std::shared_ptr<const ClimateRegion> region;
+        ClimateRegionList::iterator lruPosition;
+    };
+
+    // Cache des régions climatiques (moins récemment utilisée évincée au-delà de MAX_CLIMATE_REGIONS)
+    mutable std::mutex climateMutex;
+    mutable std::unordered_map<uint64_t, ClimateEntry> climateRegions;
+    mutable ClimateRegionList climateLru;
 
     void initializeBiomes();
+    void clearClimateCache();
+
+    // Région climatique (regionX, regionZ), calculée au premier accès
+    std::shared_ptr<const ClimateRegion> getClimateRegion(int regionX, int regionZ) const;
+
+    // Classement à partir des bruits climatiques bruts (dans [-1, 1]) et de la hauteur
+    BiomeType classifyBiome(float temperatureValue, float humidityValue, float height) const;
 };
 
 }
\ No newline at end of file
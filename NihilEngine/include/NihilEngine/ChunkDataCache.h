@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 #include <glm/glm.hpp>
+#include <NihilEngine/BiomeGenerator.h>
 
 namespace NihilEngine {
 
@@ -25,7 +26,8 @@ struct SimplifiedChunkData {
 
 class ChunkDataCache {
 public:
-    ChunkDataCache();
+    // chunkSize : côté d'un chunk en blocs (position et échelle des résumés)
+    explicit ChunkDataCache(float chunkSize = 16.0f);
     ~ChunkDataCache() = default;
 
     // Ajoute ou met à jour les données simplifiées d'un chunk
@@ -40,22 +42,29 @@ public:
     // Nettoie les anciennes données
     void cleanupOldData(double currentTime, double maxAge);
 
-    // Génère des données simplifiées à partir de données détaillées
+    // Génère des données simplifiées à partir d'échantillons width x depth en tampons contigus
+    // (heights[x + z * heightStride], biomes[x + z * biomeStride], cf. getHeightRegion / getBiomeRegion)
     SimplifiedChunkData generateSimplifiedData(
         int chunkX, int chunkZ,
-        const std::vector<std::vector<float>>& heightMap,
-        const std::vector<std::vector<int>>& biomeMap
+        const float* heights, size_t heightStride,
+        const BiomeType* biomes, size_t biomeStride,
+        int width, int depth
     );
 
     // Obtient la clé de cache pour un chunk
     static uint64_t getCacheKey(int chunkX, int chunkZ);
 
+    // Statistiques (accès via getChunkData)
+    size_t getCacheHits() const { return m_cacheHits; }
+    size_t getCacheMisses() const { return m_cacheMisses; }
+
 private:
     std::unordered_map<uint64_t, SimplifiedChunkData> m_cache;
+    float m_chunkSize;
 
     // Statistiques
-    size_t m_cacheHits = 0;
-    size_t m_cacheMisses = 0;
+    mutable size_t m_cacheHits = 0;
+    mutable size_t m_cacheMisses = 0;
 };
 
 }
\ No newline at end of file
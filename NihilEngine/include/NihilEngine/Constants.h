@@ -18,6 +18,10 @@ namespace NihilEngine {
         constexpr float CROSSHAIR_SIZE = 10.0f;
         constexpr float LINE_WIDTH_DEFAULT = 2.0f;
 
+        // Atlas de blocs (TextureManager::createTextureAtlas) : grille de tuiles
+        constexpr int ATLAS_COLUMNS = 4;
+        constexpr int ATLAS_ROWS = 2;
+
         // Physics constants
         constexpr int AXIS_COUNT = 3;
 
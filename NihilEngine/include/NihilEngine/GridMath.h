@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+namespace NihilEngine {
+
+    // Division entière arrondie vers -infini : cellule (chunk, tuile, région) contenant une coordonnée,
+    // y compris négative
+    constexpr int FloorDiv(int value, int divisor) {
+        return value >= 0 ? value / divisor : (value - divisor + 1) / divisor;
+    }
+
+    // Clé 64 bits d'une cellule de grille : X dans les 32 bits hauts, Z dans les 32 bits bas
+    // (Z masqué : un Z négatif n'écrase pas X)
+    constexpr uint64_t GridKey(int x, int z) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(z);
+    }
+
+}
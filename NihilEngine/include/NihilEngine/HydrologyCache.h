@@ -0,0 +1,93 @@
+#pragma once
+
+#include <NihilEngine/RiverGenerator.h>
+#include <NihilEngine/TerrainGenerator.h>
+#include <NihilEngine/TerrainTileCache.h>
+#include <NihilEngine/WaterGenerator.h>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace NihilEngine {
+
+/**
+ * @brief Lacs et rivières des tuiles de terrain (streaming des chunks), résolus par domaines alignés de
+ * DOMAIN_TILES² tuiles.
+ *
+ * Un domaine est calculé en une fois, au premier accès à l'une de ses tuiles : remplissage des dépressions par
+ * tuiles (WaterGenerator::fillDepressionsTiled, identique au remplissage du domaine entier d'un seul tenant),
+ * puis extraction des lacs. Chaque lac est rangé dans la tuile de sa cellule la plus basse : il est produit une
+ * seule fois, entier, avec les cellules et le niveau d'une carte du domaine entier, quelle que soit la couture
+ * de tuiles qu'il traverse. Le débit des rivières est accumulé sur le domaine entier (RiverGenerator::routeFlow
+ * sur la même surface remplie) : l'amont des autres tuiles est compté, une rivière qui franchit une couture de
+ * tuiles se prolonge dans la tuile voisine avec le même débit.
+ * Approximation locale : le bord du domaine sert d'exutoire, l'hydrologie est exacte à l'échelle du domaine
+ * (1024 blocs), pas du monde. Les niveaux ne peuvent que monter avec la taille de la fenêtre : ce sont des bornes
+ * inférieures des niveaux du monde, qui sous-estiment fortement ceux des grands bassins continentaux. Un bassin qui
+ * déborde du domaine y est coupé : ses lacs touchant le bord sont ignorés, et une dépression plus vaste que le
+ * domaine y apparaît comme les sous-bassins qu'elle contient. De même, une rivière s'arrête au bord du domaine
+ * et son débit ne compte que l'amont situé dans le domaine.
+ * Thread-safe ; au-delà de maxDomains, le domaine le moins récemment utilisé est évincé. Les domaines sont
+ * invalidés si la configuration du terrain change (cf. TerrainGenerator::getRevision).
+ */
+class HydrologyCache {
+public:
+    static constexpr int DOMAIN_TILES = 16;
+    static constexpr int DOMAIN_SIZE = DOMAIN_TILES * TerrainTileCache::TILE_SIZE;
+    static constexpr size_t DEFAULT_MAX_DOMAINS = 4;
+
+    HydrologyCache(TerrainTileCache& tiles, const TerrainGenerator& terrainGen, const WaterGenerator& waterGen,
+                   size_t maxDomains = DEFAULT_MAX_DOMAINS);
+    ~HydrologyCache() = default;
+
+    // Lacs attribués à la tuile (tileX, tileZ) ; cellules en blocs monde, y compris hors de la tuile
+    std::vector<WaterBody> getTileLakes(int tileX, int tileZ);
+    // Rivières de la tuile (tileX, tileZ) : débit au moins RiverGenerator::MIN_RIVER_FLOW, hors océan
+    RiverTile getTileRivers(int tileX, int tileZ);
+
+    size_t getDomainCount() const;
+    void clear();
+
+private:
+    struct RiverCell {
+        int index;   // x + z * TILE_SIZE dans la tuile
+        float width;
+    };
+
+    // Par tuile (i, j) du domaine, à l'indice i + j * DOMAIN_TILES
+    struct Domain {
+        std::vector<std::vector<WaterBody>> lakes;
+        std::vector<std::vector<RiverCell>> rivers; // Creux : les rivières couvrent peu de cellules
+    };
+
+    using DomainList = std::list<uint64_t>; // Plus récemment utilisé en tête
+
+    struct Entry {
+        std::shared_ptr<const Domain> domain;
+        DomainList::iterator lruPosition;
+    };
+
+    TerrainTileCache& m_tiles;
+    const TerrainGenerator& m_terrainGen;
+    const WaterGenerator& m_waterGen;
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<uint64_t, Entry> m_domains;
+    DomainList m_lru;
+    size_t m_maxDomains;
+
+    // Révision du terrain au moment des calculs
+    unsigned int m_terrainRevision;
+
+    // Domaine (domainX, domainZ), calculé au premier accès
+    std::shared_ptr<const Domain> getDomain(int domainX, int domainZ);
+    std::shared_ptr<const Domain> solveDomain(int domainX, int domainZ) const;
+
+    void invalidateIfStale();
+    void evictToCapacity();
+};
+
+}
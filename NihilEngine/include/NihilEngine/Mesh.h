@@ -2,20 +2,61 @@
 #pragma once
 
 #include <vector>
+#include <cstdint>
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 
 namespace NihilEngine {
+    // Emplacements fixes dans les shaders : Position 0, Normal 1, TexCoord 2, Color 3 (blanc si absente)
     enum class VertexAttribute {
         Position,
         Normal,
         TexCoord,
-        Color
+        Color,
+        PackedVoxel // Attribut entier : un uint32 par sommet, voir PackVoxelVertex
+    };
+
+    /**
+     * @brief Empaquette un sommet de voxel sur 32 bits (décodé par le shader de chunk).
+     * Bits 0-4 : x local, 5-9 : z local, 10-18 : y, 19-21 : face (+Z, -Z, -X, +X, +Y, -Y),
+     * 22-29 : index de tuile dans l'atlas (colonne + ligne * ATLAS_COLUMNS),
+     * 30-31 : emplacement (x, z) dans un mesh fusionné de 2x2 chunks (voir SetVoxelVertexSlot).
+     */
+    inline uint32_t PackVoxelVertex(int x, int y, int z, int face, int tile) {
+        return  static_cast<uint32_t>(x & 0x1F)
+             | (static_cast<uint32_t>(z & 0x1F) << 5)
+             | (static_cast<uint32_t>(y & 0x1FF) << 10)
+             | (static_cast<uint32_t>(face & 0x7) << 19)
+             | (static_cast<uint32_t>(tile & 0xFF) << 22);
+    }
+
+    /**
+     * @brief Place un sommet empaqueté dans l'emplacement (slotX, slotZ) d'un super-chunk 2x2 :
+     * le shader le décale d'un côté de chunk par emplacement (Renderer::SetVoxelChunkSize).
+     */
+    inline uint32_t SetVoxelVertexSlot(uint32_t packed, int slotX, int slotZ) {
+        return (packed & 0x3FFFFFFFu)
+             | (static_cast<uint32_t>(slotX & 0x1) << 30)
+             | (static_cast<uint32_t>(slotZ & 0x1) << 31);
+    }
+
+    /**
+     * @brief Sous-plage contiguë d'indices d'un mesh (ex. une direction de face d'un chunk).
+     */
+    struct MeshRange {
+        int firstIndex = 0;
+        int indexCount = 0;
     };
 
     class Mesh {
     public:
         Mesh(const std::vector<float>& vertices, const std::vector<unsigned int>& indices, const std::vector<VertexAttribute>& attributes);
+
+        /**
+         * @brief Géométrie de voxels : des quads de 4 sommets consécutifs, sans indices propres.
+         * Les indices viennent d'un tampon de quads partagé (16 bits tant que possible).
+         */
+        Mesh(const std::vector<uint32_t>& vertices, const std::vector<VertexAttribute>& attributes);
         ~Mesh();
 
         Mesh(Mesh&& other) noexcept;
@@ -25,6 +66,11 @@ namespace NihilEngine {
         void Unbind() const;
         void Draw() const;
 
+        /**
+         * @brief Dessine uniquement une sous-plage d'indices (le mesh doit être lié).
+         */
+        void DrawRange(const MeshRange& range) const;
+
         // *** CORRECTION AJOUTÉE ***
         /**
          * @brief Renvoie le nombre d'indices dans ce mesh.
@@ -32,13 +78,23 @@ namespace NihilEngine {
          */
         int GetIndexCount() const;
 
+        /**
+         * @brief Indique si le mesh utilise le format de sommet de voxel empaqueté (shader de chunk).
+         */
+        bool IsPackedVoxel() const { return m_PackedVoxel; }
+
         static Mesh CreateCube(float size = 1.0f);
         static Mesh CreateTriangle(float size = 1.0f);
         static Mesh CreateQuad(float size = 1.0f);
 
     private:
-        GLuint m_VAO, m_VBO, m_EBO;
-        int m_IndexCount;
+        GLuint m_VAO = 0, m_VBO = 0, m_EBO = 0;
+        int m_IndexCount = 0;
+        GLenum m_IndexType = GL_UNSIGNED_INT;
+        bool m_OwnsIndexBuffer = false; // false : m_EBO est le tampon de quads partagé
+        bool m_PackedVoxel = false;
+        void Upload(const void* vertexData, size_t componentCount, const std::vector<VertexAttribute>& attributes);
+        void Release();
         void SetupAttributes(const std::vector<VertexAttribute>& attributes);
     };
 }
\ No newline at end of file
@@ -1,10 +1,64 @@
 #pragma once
 
 #include <vector>
+#include <cstddef>
 #include <glm/glm.hpp>
 
 namespace NihilEngine {
 
+// Fonction de base d'une couche de bruit (octaves de fractal/ridged)
+enum class NoiseBasis {
+    Perlin,
+    Simplex // 3 gradients par échantillon en 2D au lieu de 4
+};
+
+// Description déclarative d'une couche : mêmes paramètres que fractal() / ridged()
+struct NoiseLayer {
+    enum class Type { Fractal, Ridged };
+
+    Type type = Type::Fractal;
+    int octaves = 4;
+    float persistence = 0.5f;
+    float scale = 1.0f;
+    NoiseBasis basis = NoiseBasis::Perlin;
+};
+
+/**
+ * @brief Plan d'évaluation de plusieurs couches en une passe (voir Noise::evaluateLayers).
+ *
+ * Les octaves de même fréquence et de même base sont partagés entre couches : le bruit
+ * n'y est calculé qu'une fois. Chaque couche reste identique bit à bit à fractal() / ridged().
+ */
+class NoiseLayerSet {
+public:
+    static const size_t MAX_SAMPLES = 32; // Octaves distincts partagés par evaluateLayers (au-delà, évalués séparément)
+
+    explicit NoiseLayerSet(const std::vector<NoiseLayer>& layers = {});
+
+    size_t getLayerCount() const { return layerTypes.size(); }
+    // Évaluations de bruit par point (au lieu de la somme des octaves des couches)
+    size_t getSampleCount() const { return samples.size(); }
+
+private:
+    friend class Noise;
+
+    struct Sample {
+        float frequency;
+        NoiseBasis basis;
+    };
+
+    struct Term {
+        int sample;
+        float amplitude;
+        float tailMean; // Espérance de ce terme et des suivants de la couche (octaves ignorés, cf. sampleSpacing)
+    };
+
+    std::vector<Sample> samples;
+    std::vector<Term> terms;                // Par couche, dans l'ordre des octaves
+    std::vector<size_t> layerTermOffsets;   // Début des termes de chaque couche, puis fin
+    std::vector<NoiseLayer::Type> layerTypes;
+};
+
 class Noise {
 public:
     Noise(unsigned int seed = 0);
@@ -16,14 +70,53 @@ public:
     // Génère du bruit Perlin 3D
     float perlin3D(float x, float y, float z) const;
 
-    // Génère du bruit Simplex 2D (plus rapide que Perlin)
+    // Génère du bruit Simplex 2D (plus rapide que Perlin), même table de permutation, valeurs dans [-1, 1]
     float simplex2D(float x, float y) const;
 
+    // Génère du bruit Simplex 3D (4 gradients au lieu de 8)
+    float simplex3D(float x, float y, float z) const;
+
     // Génère du bruit fractal (multiple octaves)
-    float fractal(float x, float y, int octaves = 4, float persistence = 0.5f, float scale = 1.0f) const;
+    float fractal(float x, float y, int octaves = 4, float persistence = 0.5f, float scale = 1.0f,
+                  NoiseBasis basis = NoiseBasis::Perlin) const;
 
     // Génère du bruit de ridged (pour montagnes)
-    float ridged(float x, float y, int octaves = 4, float persistence = 0.5f, float scale = 1.0f) const;
+    float ridged(float x, float y, int octaves = 4, float persistence = 0.5f, float scale = 1.0f,
+                 NoiseBasis basis = NoiseBasis::Perlin) const;
+
+    // --- Évaluation par lots (AVX2 / SSE4.1 / scalaire, choisi à l'exécution) ---
+    // Résultats identiques bit à bit aux appels point par point, tant que le compilateur ne fusionne
+    // pas les multiplications-additions (FMA, ex. -march=native) : l'écart reste alors sous 1e-5.
+
+    // out[i] = perlin2D(xs[i], ys[i])
+    void perlin2DBatch(const float* xs, const float* ys, float* out, size_t count) const;
+
+    // Grilles : out[i + j * width] = fractal(originX + i * step, originY + j * step, ...)
+    // (base Simplex : boucle scalaire, déjà moins coûteuse par échantillon)
+    void fractalGrid(float* out, int width, int height, float originX, float originY, float step,
+                     int octaves = 4, float persistence = 0.5f, float scale = 1.0f,
+                     NoiseBasis basis = NoiseBasis::Perlin) const;
+    void ridgedGrid(float* out, int width, int height, float originX, float originY, float step,
+                    int octaves = 4, float persistence = 0.5f, float scale = 1.0f,
+                    NoiseBasis basis = NoiseBasis::Perlin) const;
+
+    // Toutes les couches d'un plan en un point : values[i] = couche i
+    // sampleSpacing > 0 : les octaves de longueur d'onde inférieure (fréquence > 1 / sampleSpacing) sont
+    // remplacés par leur espérance (somme des amplitudes ignorées fois E[n] en fractal, E[(1 - |n|)²] en
+    // ridged) : sans eux la couche serait biaisée (les termes ridged sont tous positifs, le Perlin n'est pas
+    // centré). Reste un écart par point de moyenne nulle, au plus de l'ordre des amplitudes ignorées.
+    void evaluateLayers(const NoiseLayerSet& layers, float x, float y, float* values, float sampleSpacing = 0.0f) const;
+
+    // Même chose sur une grille : outs[i][a + b * width] = couche i en (originX + a * step, originY + b * step)
+    void evaluateLayersGrid(const NoiseLayerSet& layers, float* const* outs, int width, int height,
+                            float originX, float originY, float step, float sampleSpacing = 0.0f) const;
+
+    enum class SimdLevel { Scalar, SSE41, AVX2 };
+
+    // Jeu d'instructions utilisé par les lots (le meilleur supporté par le processeur)
+    static SimdLevel getSimdLevel();
+    // Force un niveau inférieur (comparaisons, benchmarks) ; plafonné au niveau supporté
+    static void setSimdLevel(SimdLevel level);
 
 private:
     std::vector<int> p; // Permutation table
@@ -32,9 +125,6 @@ private:
     float fade(float t) const;
     float lerp(float a, float b, float t) const;
     float grad(int hash, float x, float y, float z) const;
-
-    // Fonctions pour Simplex
-    float simplexGrad(int hash, float x, float y) const;
 };
 
 }
\ No newline at end of file
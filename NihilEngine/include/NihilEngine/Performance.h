@@ -16,8 +16,25 @@ public:
     LODManager();
 
     void addLODLevel(float distance, float detailLevel);
+    void clearLODLevels();
     float getDetailLevel(const glm::vec3& position, const glm::vec3& cameraPosition) const;
 
+    // Niveaux discrets : le niveau i couvre les distances jusqu'à m_LODLevels[i].distance,
+    // le niveau getLevelCount() tout ce qui est au-delà du dernier seuil
+    size_t getLevelCount() const { return m_LODLevels.size(); }
+
+    /**
+     * @brief Niveau discret pour une distance, avec hystérésis : le niveau courant est gardé
+     * tant que la distance ne dépasse pas ses seuils de plus de `hysteresis`.
+     * @param currentLevel Niveau actuel de l'objet (-1 si aucun)
+     */
+    int getLevelIndex(float distance, int currentLevel = -1, float hysteresis = 0.0f) const;
+
+    /**
+     * @brief Détail d'un niveau discret (au-delà du dernier seuil : moitié du dernier, comme getDetailLevel).
+     */
+    float getLevelDetail(int level) const;
+
     // Performance utilities
     static void enableVSync(bool enable);
     static void setTargetFPS(float fps);
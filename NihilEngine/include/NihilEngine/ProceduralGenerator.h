@@ -2,9 +2,11 @@
 
 #include <NihilEngine/TerrainGenerator.h>
 #include <NihilEngine/BiomeGenerator.h>
+#include <NihilEngine/HydrologyCache.h>
 #include <NihilEngine/RiverGenerator.h>
 #include <NihilEngine/VegetationGenerator.h>
 #include <NihilEngine/WaterGenerator.h>
+#include <NihilEngine/TerrainTileCache.h>
 #include <vector>
 #include <memory>
 
@@ -33,6 +35,12 @@ public:
     VegetationGenerator& getVegetationGenerator() { return *vegGen; }
     WaterGenerator& getWaterGenerator() { return *waterGen; }
 
+    // Tuiles hauteurs + biomes partagées par tous les générateurs (coordonnées entières de blocs)
+    TerrainTileCache& getTileCache() { return *tileCache; }
+
+    // Lacs et rivières par tuile, résolus par domaines à partir des mêmes tuiles
+    HydrologyCache& getHydrologyCache() { return *hydrology; }
+
     // Paramètres globaux
     void setSeed(unsigned int seed);
     unsigned int getSeed() const { return seed; }
@@ -44,6 +52,8 @@ private:
     std::unique_ptr<RiverGenerator> riverGen;
     std::unique_ptr<VegetationGenerator> vegGen;
     std::unique_ptr<WaterGenerator> waterGen;
+    std::unique_ptr<TerrainTileCache> tileCache;
+    std::unique_ptr<HydrologyCache> hydrology;
 
     void initializeGenerators();
 };
@@ -22,6 +22,11 @@ namespace NihilEngine {
 
         void Clear();
         void DrawEntity(const Entity& entity, const Camera& camera);
+
+        /**
+         * @brief Dessine seulement certaines plages d'indices du mesh de l'entité (une passe d'état, plusieurs draws).
+         */
+        void DrawEntity(const Entity& entity, const Camera& camera, const MeshRange* ranges, size_t rangeCount);
         void DrawCrosshair(int windowWidth, int windowHeight);
         void DrawLine3D(const glm::vec3& start, const glm::vec3& end, const Camera& camera, const glm::vec3& color, float width = 1.0f);
         void DrawWireCube(const glm::vec3& min, const glm::vec3& max, const Camera& camera, const glm::vec3& color);
@@ -32,6 +37,9 @@ namespace NihilEngine {
         void SetFogColor(const glm::vec3& color);
         void SetFogDensity(float density);
 
+        // Côté d'un chunk en blocs : décalage des emplacements de super-chunk (SetVoxelVertexSlot)
+        void SetVoxelChunkSize(int size);
+
         // Particles
         void AddParticle(const Particle& particle);
         void UpdateParticles(float deltaTime);
@@ -43,7 +51,14 @@ namespace NihilEngine {
         void InitLineShader();
         void InitParticleShader();
 
+        /**
+         * @brief Active le shader de l'entité et règle ses uniformes (caméra, lumière, brouillard, matériau).
+         * @return true si une texture a été liée (à délier après le dessin)
+         */
+        bool BeginEntity(const Entity& entity, const Camera& camera);
+
         unsigned int m_ShaderProgram = 0;
+        unsigned int m_ChunkShaderProgram = 0; // Sommets de voxel empaquetés (Mesh::IsPackedVoxel)
         unsigned int m_CrosshairShaderProgram = 0;
         unsigned int m_LineShaderProgram = 0;
         unsigned int m_ParticleShaderProgram = 0;
@@ -56,6 +71,8 @@ namespace NihilEngine {
         glm::vec3 m_FogColor = glm::vec3(0.5f, 0.5f, 0.5f);
         float m_FogDensity = 0.01f;
 
+        int m_VoxelChunkSize = 16;
+
         // Particles
         std::vector<Particle> m_Particles;
     };
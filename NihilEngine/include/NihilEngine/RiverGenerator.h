@@ -1,7 +1,7 @@
 #pragma once
 
 #include <NihilEngine/Noise.h>
-#include <NihilEngine/TerrainGenerator.h>
+#include <NihilEngine/TerrainTileCache.h>
 #include <vector>
 #include <glm/glm.hpp>
 
@@ -13,28 +13,53 @@ struct RiverPoint {
     float depth;
 };
 
+// Réseau de rivières d'une tuile de terrain (cf. HydrologyCache::getTileRivers) : largeur par bloc, 0 hors
+// rivière (requête O(1))
+struct RiverTile {
+    int originX = 0;            // Premier bloc de la tuile (monde)
+    int originZ = 0;
+    std::vector<float> widths;  // widths[x + z * TILE_SIZE]
+
+    float getWidth(int x, int z) const {
+        return widths[(x - originX) + (z - originZ) * TerrainTileCache::TILE_SIZE];
+    }
+    bool isRiver(int x, int z) const { return getWidth(x, z) > 0.0f; }
+};
+
 class RiverGenerator {
 public:
+    // Surface drainée (en cellules) à partir de laquelle un écoulement devient une rivière
+    static constexpr float MIN_RIVER_FLOW = 200.0f;
+
     RiverGenerator(unsigned int seed = 0);
     ~RiverGenerator() = default;
 
-    // Génère une rivière à partir d'un point source
-    std::vector<RiverPoint> generateRiver(const glm::vec2& startPos, const TerrainGenerator& terrainGen, float maxLength = 1000.0f);
-
-    // Génère plusieurs rivières dans une région
-    std::vector<std::vector<RiverPoint>> generateRivers(int width, int height, float scale, const TerrainGenerator& terrainGen, int numRivers = 5);
+    // Génère les numRivers plus grandes rivières de la région (de la source à l'embouchure), tracées sur
+    // le réseau d'écoulement D8 ; largeur et profondeur croissent avec le débit accumulé
+    std::vector<std::vector<RiverPoint>> generateRivers(int width, int height, float scale, TerrainTileCache& tiles, int numRivers = 5);
 
     // Modifie la heightmap pour inclure les rivières
     void carveRivers(std::vector<std::vector<float>>& heightMap, const std::vector<std::vector<RiverPoint>>& rivers, float scale);
 
+    // Écoulement D8 et débit accumulé d'une grille (Priority-Flood puis routeFlow) :
+    // receivers[i] = cellule aval (-1 : sortie par le bord), flow[i] = nombre de cellules drainées, i compris
+    static void computeFlow(const float* heights, size_t stride, int width, int depth,
+                            std::vector<int>& receivers, std::vector<float>& flow);
+
+    // Écoulement D8 sur une surface déjà remplie (dense, width * depth) : plus forte pente, plats drainés vers
+    // leur sortie la plus proche, puis accumulation en ordre topologique. Les bords sont les exutoires
+    static void routeFlow(const float* filled, int width, int depth,
+                          std::vector<int>& receivers, std::vector<float>& flow);
+
+    // Largeur et profondeur d'une rivière pour un débit donné (croissance en racine du débit)
+    static float riverWidth(float flow);
+    static float riverDepth(float flow);
+
 private:
     Noise noise;
 
-    // Trouve le point le plus bas adjacent
-    glm::vec2 findLowestNeighbor(const glm::vec2& pos, const TerrainGenerator& terrainGen, float stepSize = 1.0f) const;
-
     // Vérifie si une position est valide (dans les limites)
     bool isValidPosition(const glm::vec2& pos, int width, int height, float scale) const;
 };
 
-}
\ No newline at end of file
+}
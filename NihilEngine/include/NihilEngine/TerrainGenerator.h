@@ -12,25 +12,59 @@ public:
     ~TerrainGenerator() = default;
 
     // Génère une hauteur pour une position donnée
-    float getHeight(float x, float z) const;
+    // sampleSpacing > 0 (requêtes lointaines, grilles grossières) : octaves de longueur d'onde < sampleSpacing
+    // remplacés par leur espérance (cf. Noise::evaluateLayers). Sans cette correction, les hauteurs étaient
+    // biaisées vers le bas (-0.55 bloc en moyenne à 16, -2.2 à 32, -5.7 à 64). Mesuré sur le terrain par défaut
+    // (pics dus aux valeurs du Perlin hors de [-1, 1]) : espacement <= 8 exact ; 16 -> biais ~0.02 bloc, écart
+    // moyen ~0.4 (max ~4), coût ~0.8x ; 32 -> biais ~0.02, écart moyen ~1 (max ~30), coût ~0.55x
+    float getHeight(float x, float z, float sampleSpacing = 0.0f) const;
+
+    // Hauteurs d'un rectangle dans un tampon fourni (bruit par lots) :
+    // out[i + j * stride] = getHeight(originX + i * step, originZ + j * step, sampleSpacing), stride >= width
+    void getHeightRegion(float* out, size_t stride, int width, int depth, float originX, float originZ,
+                         float step = 1.0f, float sampleSpacing = 0.0f) const;
+
+    // Grille contiguë : getHeightRegion avec stride = width
+    void getHeightGrid(float* out, int width, int depth, float originX, float originZ,
+                       float step = 1.0f, float sampleSpacing = 0.0f) const {
+        getHeightRegion(out, static_cast<size_t>(width), width, depth, originX, originZ, step, sampleSpacing);
+    }
 
     // Génère une carte de hauteur pour une région
     std::vector<std::vector<float>> generateHeightMap(int width, int height, float scale = 1.0f) const;
 
-    // Paramètres de génération
-    void setBaseHeight(float height) { baseHeight = height; }
-    void setAmplitude(float amp) { amplitude = amp; }
-    void setFrequency(float freq) { frequency = freq; }
-    void setOctaves(int oct) { octaves = oct; }
-    void setPersistence(float pers) { persistence = pers; }
+    // Paramètres de génération (le plan des couches de bruit est recompilé à chaque changement)
+    void setBaseHeight(float height) { baseHeight = height; ++revision; }
+    void setAmplitude(float amp) { amplitude = amp; ++revision; }
+    void setFrequency(float freq) { frequency = freq; rebuildLayers(); }
+    void setOctaves(int oct) { octaves = oct; rebuildLayers(); }
+    void setPersistence(float pers) { persistence = pers; rebuildLayers(); }
+
+    // Fonction de base par couche (relief de base, montagnes) ; Perlin par défaut
+    void setBaseBasis(NoiseBasis basis) { baseBasis = basis; rebuildLayers(); }
+    void setMountainBasis(NoiseBasis basis) { mountainBasis = basis; rebuildLayers(); }
+
+    // Incrémentée à chaque changement de paramètre (invalidation des caches, cf. TerrainTileCache)
+    unsigned int getRevision() const { return revision; }
 
 private:
+    // Index des couches dans layers
+    enum Layer { BASE_LAYER, MOUNTAIN_LAYER, LAYER_COUNT };
+
     Noise noise;
     float baseHeight;
     float amplitude;
     float frequency;
     int octaves;
     float persistence;
+    NoiseBasis baseBasis = NoiseBasis::Perlin;
+    NoiseBasis mountainBasis = NoiseBasis::Perlin;
+
+    // Relief de base (fractal) et montagnes (ridged, octaves partagés avec le relief)
+    NoiseLayerSet layers;
+    unsigned int revision = 0;
+
+    void rebuildLayers();
 };
 
 }
\ No newline at end of file
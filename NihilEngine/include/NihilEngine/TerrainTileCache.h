@@ -0,0 +1,89 @@
+#pragma once
+
+#include <NihilEngine/TerrainGenerator.h>
+#include <NihilEngine/BiomeGenerator.h>
+#include <array>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace NihilEngine {
+
+/**
+ * @brief Cache partagé de tuiles de terrain (hauteurs + biomes) aux coordonnées entières de blocs.
+ *
+ * Les générateurs (chunks, rivières, monde complet) lisent à travers ce cache au lieu de réévaluer
+ * le bruit. Valeurs identiques bit à bit à TerrainGenerator::getHeight / BiomeGenerator::getBiome.
+ * Thread-safe ; au-delà du plafond mémoire, la tuile la moins récemment utilisée est évincée.
+ * Les tuiles sont invalidées si la configuration d'un générateur change (cf. getRevision).
+ */
+class TerrainTileCache {
+public:
+    static constexpr int TILE_SIZE = 64;
+    static constexpr size_t DEFAULT_MAX_BYTES = 16 * 1024 * 1024;
+
+    struct Tile {
+        std::array<float, TILE_SIZE * TILE_SIZE> heights;     // heights[x + z * TILE_SIZE]
+        std::array<BiomeType, TILE_SIZE * TILE_SIZE> biomes;
+    };
+
+    TerrainTileCache(const TerrainGenerator& terrainGen, const BiomeGenerator& biomeGen,
+                     size_t maxBytes = DEFAULT_MAX_BYTES);
+    ~TerrainTileCache() = default;
+
+    // Tuile (tileX, tileZ), générée au premier accès
+    std::shared_ptr<const Tile> getTile(int tileX, int tileZ);
+
+    // Valeurs d'une colonne (coordonnées monde en blocs)
+    float getHeight(int x, int z);
+    BiomeType getBiome(int x, int z);
+
+    // Rectangle width x depth à partir de (originX, originZ) : heights[i + j * heightStride], idem biomes
+    // (biomes peut être nul si seules les hauteurs sont utiles)
+    void getRegion(float* heights, size_t heightStride, BiomeType* biomes, size_t biomeStride,
+                   int originX, int originZ, int width, int depth);
+
+    // Plafond mémoire (tuiles évincées immédiatement si nécessaire)
+    void setMaxBytes(size_t maxBytes);
+    size_t getMaxTiles() const;
+    size_t getTileCount() const;
+
+    // Statistiques
+    size_t getCacheHits() const;
+    size_t getCacheMisses() const;
+
+    void clear();
+
+private:
+    using TileList = std::list<uint64_t>; // Plus récemment utilisée en tête
+
+    struct Entry {
+        std::shared_ptr<const Tile> tile;
+        TileList::iterator lruPosition;
+    };
+
+    const TerrainGenerator& m_terrainGen;
+    const BiomeGenerator& m_biomeGen;
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<uint64_t, Entry> m_tiles;
+    TileList m_lru;
+    size_t m_maxTiles;
+
+    // Révisions des générateurs au moment du remplissage
+    unsigned int m_terrainRevision;
+    unsigned int m_biomeRevision;
+
+    size_t m_cacheHits = 0;
+    size_t m_cacheMisses = 0;
+
+    std::shared_ptr<const Tile> generateTile(int tileX, int tileZ) const;
+
+    // Appelés verrou pris
+    void invalidateIfStale();
+    void evictToCapacity();
+};
+
+}
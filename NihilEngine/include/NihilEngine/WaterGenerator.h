@@ -1,6 +1,6 @@
 #pragma once
 
-#include <NihilEngine/TerrainGenerator.h>
+#include <NihilEngine/Noise.h>
 #include <vector>
 #include <glm/glm.hpp>
 
@@ -14,13 +14,17 @@ enum class WaterType {
 
 struct WaterBody {
     WaterType type;
-    std::vector<glm::vec2> outline;
+    std::vector<glm::vec2> outline;   // Lacs : points du pourtour, non ordonnés
     float waterLevel;
     glm::vec3 color;
+    std::vector<glm::ivec2> cells;    // Lacs : cellules couvertes, en coordonnées de carte (monde / scale)
 };
 
 class WaterGenerator {
 public:
+    // Profondeur minimale d'un lac (en dessous : flaque ignorée)
+    static constexpr float MIN_LAKE_DEPTH = 0.5f;
+
     WaterGenerator(unsigned int seed = 0);
     ~WaterGenerator() = default;
 
@@ -34,6 +38,28 @@ public:
     // Détermine si une position est sous l'eau
     bool isUnderwater(const glm::vec2& pos, const std::vector<WaterBody>& waterBodies) const;
 
+    // Remplissage des dépressions (Priority-Flood amélioré, Barnes et al. 2014), O(n log n), 8-connexe :
+    // filled[i + j * width] = niveau de l'eau stagnante en (i, j), >= hauteur ; les bords sont les exutoires.
+    // Optionnels : receivers[i] = cellule par laquelle le remplissage a atteint i (écoulement D8 qui traverse
+    // lacs et plats jusqu'à un bord, -1 sur les bords) ; order = cellules dans l'ordre d'atteinte (aval d'abord)
+    static void fillDepressions(const float* heights, size_t stride, int width, int depth, std::vector<float>& filled,
+                                std::vector<int>* receivers = nullptr, std::vector<int>* order = nullptr);
+
+    // Même résultat que fillDepressions (sans receivers ni order), calculé par tuiles de tileSize² cellules
+    // (Priority-Flood parallèle, Barnes 2016) : chaque tuile est remplie depuis son propre pourtour, les bassins
+    // ainsi obtenus sont reliés par leurs niveaux de débordement (dans la tuile et à travers les arêtes), le
+    // niveau de chaque bassin est propagé depuis le bord de la grille, puis reporté dans les tuiles
+    static void fillDepressionsTiled(const float* heights, size_t stride, int width, int depth, int tileSize,
+                                     std::vector<float>& filled);
+
+    // Lacs d'une grille déjà remplie : composantes 8-connexes des cellules noyées (filled > hauteur), au-dessus
+    // du niveau de l'océan et profondes d'au moins MIN_LAKE_DEPTH ; celles qui touchent le bord de la grille
+    // (niveau incertain) sont ignorées. Cellule (0, 0) en (cellX, cellZ) sur la carte ; lowestCells (optionnel) :
+    // cellule la plus basse de chaque lac (égalités : plus petit z, puis x), qui sert à l'attribuer à une tuile
+    std::vector<WaterBody> findLakes(const float* heights, size_t stride, int width, int depth,
+                                     const std::vector<float>& filled, int cellX, int cellZ, float scale,
+                                     std::vector<glm::ivec2>* lowestCells = nullptr) const;
+
 private:
     Noise noise;
 
@@ -43,14 +69,6 @@ private:
     // Génère les lacs dans les dépressions
     std::vector<WaterBody> generateLakes(int width, int height, float scale,
                                         const std::vector<std::vector<float>>& heightMap);
-
-    // Trouve les dépressions locales pour les lacs
-    std::vector<glm::vec2> findDepressions(int width, int height, float scale,
-                                          const std::vector<std::vector<float>>& heightMap);
-
-    // Calcule le niveau d'eau pour un lac
-    float calculateLakeLevel(const glm::vec2& center, float radius,
-                           const std::vector<std::vector<float>>& heightMap, float scale);
 };
 
 }
\ No newline at end of file
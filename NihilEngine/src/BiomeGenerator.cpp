@@ -1,8 +1,19 @@
 #include <NihilEngine/BiomeGenerator.h>
+#include <NihilEngine/GridMath.h>
 #include <algorithm>
+#include <cmath>
 
 namespace NihilEngine {
 
+namespace {
+    // Interpolation bilinéaire entre nodes[0], nodes[1], nodes[rowStride], nodes[rowStride + 1]
+    inline float Bilerp(const float* nodes, int rowStride, float fx, float fz) {
+        float top = nodes[0] + (nodes[1] - nodes[0]) * fx;
+        float bottom = nodes[rowStride] + (nodes[rowStride + 1] - nodes[rowStride]) * fx;
+        return top + (bottom - top) * fz;
+    }
+}
+
 BiomeGenerator::BiomeGenerator(unsigned int seed)
     : temperatureNoise(seed + 1), humidityNoise(seed + 2) {
     initializeBiomes();
@@ -22,9 +33,116 @@ void BiomeGenerator::initializeBiomes() {
 }
 
 BiomeType BiomeGenerator::getBiome(float x, float z, float height) const {
-    // Génère température et humidité
-    float temperature = temperatureNoise.fractal(x * 0.001f, z * 0.001f, 3, 0.5f, 1.0f) * 0.5f + 0.5f;
-    float humidity = humidityNoise.fractal(x * 0.001f, z * 0.001f, 3, 0.5f, 1.0f) * 0.5f + 0.5f;
+    // Même interpolation que les régions : un point et un lot donnent toujours le même biome
+    BiomeType biome;
+    getBiomeRegion(&biome, 1, 1, 1, x, z, 1.0f, &height, 1);
+    return biome;
+}
+
+void BiomeGenerator::getBiomeRegion(BiomeType* out, size_t stride, int width, int depth, float originX, float originZ,
+                                    float step, const float* heights, size_t heightStride) const {
+    if (width <= 0 || depth <= 0) return;
+
+    // Échantillons au moins aussi espacés que le réseau (horizon, cartes grossières) : le climat est évalué
+    // directement, sans charger de régions (écart à getBiome documenté dans l'en-tête). Échelle 0.001 portée par
+    // la fréquence : mêmes valeurs que fractal(x * 0.001)
+    if (step >= CLIMATE_CELL) {
+        const size_t count = static_cast<size_t>(width) * depth;
+        // Tampon propre au thread, comme TerrainGenerator::getHeightRegion : aucune allocation une fois chaud
+        static thread_local std::vector<float> climate;
+        if (climate.size() < count * 2) climate.resize(count * 2);
+        float* temperatures = climate.data();
+        float* humidities = climate.data() + count;
+        temperatureNoise.fractalGrid(temperatures, width, depth, originX, originZ, step, 3, 0.5f, 0.001f, temperatureBasis);
+        humidityNoise.fractalGrid(humidities, width, depth, originX, originZ, step, 3, 0.5f, 0.001f, humidityBasis);
+
+        for (int j = 0; j < depth; ++j) {
+            const size_t row = static_cast<size_t>(j) * width;
+            for (int i = 0; i < width; ++i) {
+                out[i + j * stride] = classifyBiome(temperatures[row + i], humidities[row + i], heights[i + j * heightStride]);
+            }
+        }
+        return;
+    }
+
+    const float invCell = 1.0f / CLIMATE_CELL;
+
+    // Région courante gardée entre colonnes : un seul accès au cache par chunk
+    std::shared_ptr<const ClimateRegion> region;
+    int regionX = 0;
+    int regionZ = 0;
+
+    for (int j = 0; j < depth; ++j) {
+        float cellZ = (originZ + j * step) * invCell;
+        int cz = static_cast<int>(std::floor(cellZ));
+        float fz = cellZ - cz;
+        int rz = FloorDiv(cz, CLIMATE_REGION_CELLS);
+
+        for (int i = 0; i < width; ++i) {
+            float cellX = (originX + i * step) * invCell;
+            int cx = static_cast<int>(std::floor(cellX));
+            float fx = cellX - cx;
+            int rx = FloorDiv(cx, CLIMATE_REGION_CELLS);
+
+            if (!region || rx != regionX || rz != regionZ) {
+                region = getClimateRegion(rx, rz);
+                regionX = rx;
+                regionZ = rz;
+            }
+
+            int node = (cx - rx * CLIMATE_REGION_CELLS) + (cz - rz * CLIMATE_REGION_CELLS) * CLIMATE_REGION_NODES;
+            float temperature = Bilerp(region->temperature.data() + node, CLIMATE_REGION_NODES, fx, fz);
+            float humidity = Bilerp(region->humidity.data() + node, CLIMATE_REGION_NODES, fx, fz);
+            out[i + j * stride] = classifyBiome(temperature, humidity, heights[i + j * heightStride]);
+        }
+    }
+}
+
+std::shared_ptr<const BiomeGenerator::ClimateRegion> BiomeGenerator::getClimateRegion(int regionX, int regionZ) const {
+    uint64_t key = GridKey(regionX, regionZ);
+    {
+        std::lock_guard<std::mutex> lock(climateMutex);
+        auto it = climateRegions.find(key);
+        if (it != climateRegions.end()) {
+            climateLru.splice(climateLru.begin(), climateLru, it->second.lruPosition);
+            return it->second.region;
+        }
+    }
+
+    // Calcul hors verrou ; si un autre thread a inséré la région entre-temps, la sienne est gardée
+    // Échelle 0.001 portée par la fréquence : x * (0.001 * 2^k) == (x * 0.001) * 2^k, mêmes nœuds que fractal(x * 0.001)
+    auto region = std::make_shared<ClimateRegion>();
+    const float spacing = static_cast<float>(CLIMATE_CELL);
+    const float originX = static_cast<float>(regionX) * CLIMATE_REGION_CELLS * spacing;
+    const float originZ = static_cast<float>(regionZ) * CLIMATE_REGION_CELLS * spacing;
+    temperatureNoise.fractalGrid(region->temperature.data(), CLIMATE_REGION_NODES, CLIMATE_REGION_NODES,
+                                 originX, originZ, spacing, 3, 0.5f, 0.001f, temperatureBasis);
+    humidityNoise.fractalGrid(region->humidity.data(), CLIMATE_REGION_NODES, CLIMATE_REGION_NODES,
+                              originX, originZ, spacing, 3, 0.5f, 0.001f, humidityBasis);
+
+    std::lock_guard<std::mutex> lock(climateMutex);
+    auto inserted = climateRegions.emplace(key, ClimateEntry{std::move(region), climateLru.end()});
+    if (inserted.second) {
+        climateLru.push_front(key);
+        inserted.first->second.lruPosition = climateLru.begin();
+        if (climateRegions.size() > MAX_CLIMATE_REGIONS) {
+            climateRegions.erase(climateLru.back());
+            climateLru.pop_back();
+        }
+    }
+    return inserted.first->second.region;
+}
+
+void BiomeGenerator::clearClimateCache() {
+    ++revision;
+    std::lock_guard<std::mutex> lock(climateMutex);
+    climateRegions.clear();
+    climateLru.clear();
+}
+
+BiomeType BiomeGenerator::classifyBiome(float temperatureValue, float humidityValue, float height) const {
+    float temperature = temperatureValue * 0.5f + 0.5f;
+    float humidity = humidityValue * 0.5f + 0.5f;
 
     // Ajuste selon la hauteur (plus haut = plus froid et sec)
     temperature -= height * 0.01f;
@@ -57,13 +175,10 @@ std::vector<std::vector<BiomeType>> BiomeGenerator::generateBiomeMap(int width,
                                                                    const std::vector<std::vector<float>>& heightMap) const {
     std::vector<std::vector<BiomeType>> biomeMap(height, std::vector<BiomeType>(width));
 
+    // Une ligne par lot : les lignes de heightMap ne sont pas contiguës entre elles
     for (int z = 0; z < height; ++z) {
-        for (int x = 0; x < width; ++x) {
-            float worldX = static_cast<float>(x) * scale;
-            float worldZ = static_cast<float>(z) * scale;
-            float height = heightMap[z][x];
-            biomeMap[z][x] = getBiome(worldX, worldZ, height);
-        }
+        getBiomeRegion(biomeMap[z].data(), static_cast<size_t>(width), width, 1,
+                       0.0f, static_cast<float>(z) * scale, scale, heightMap[z].data(), static_cast<size_t>(width));
     }
 
     return biomeMap;
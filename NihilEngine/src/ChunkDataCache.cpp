@@ -1,10 +1,12 @@
 #include <NihilEngine/ChunkDataCache.h>
+#include <NihilEngine/GridMath.h>
 #include <algorithm>
+#include <array>
 #include <limits>
 
 namespace NihilEngine {
 
-ChunkDataCache::ChunkDataCache() = default;
+ChunkDataCache::ChunkDataCache(float chunkSize) : m_chunkSize(chunkSize) {}
 
 void ChunkDataCache::updateChunkData(int chunkX, int chunkZ, const SimplifiedChunkData& data) {
     uint64_t key = getCacheKey(chunkX, chunkZ);
@@ -15,8 +17,10 @@ const SimplifiedChunkData* ChunkDataCache::getChunkData(int chunkX, int chunkZ)
     uint64_t key = getCacheKey(chunkX, chunkZ);
     auto it = m_cache.find(key);
     if (it != m_cache.end()) {
+        ++m_cacheHits;
         return &it->second;
     }
+    ++m_cacheMisses;
     return nullptr;
 }
 
@@ -39,76 +43,54 @@ void ChunkDataCache::cleanupOldData(double currentTime, double maxAge) {
 
 SimplifiedChunkData ChunkDataCache::generateSimplifiedData(
     int chunkX, int chunkZ,
-    const std::vector<std::vector<float>>& heightMap,
-    const std::vector<std::vector<int>>& biomeMap
+    const float* heights, size_t heightStride,
+    const BiomeType* biomes, size_t biomeStride,
+    int width, int depth
 ) {
     SimplifiedChunkData data;
-    data.position = glm::vec3(chunkX * 16.0f, 0.0f, chunkZ * 16.0f); // 16 = chunk size
+    data.position = glm::vec3(chunkX * m_chunkSize, 0.0f, chunkZ * m_chunkSize);
+    if (width <= 0 || depth <= 0) return data; // Sécurité
 
     // Calcul des statistiques de hauteur
     float minH = std::numeric_limits<float>::max();
-    float maxH = std::numeric_limits<float>::min();
+    float maxH = std::numeric_limits<float>::lowest();
     float sumH = 0.0f;
-    int count = 0;
 
     // Compte des biomes
-    std::unordered_map<int, int> biomeCounts;
+    std::array<int, static_cast<size_t>(BiomeType::Swamp) + 1> biomeCounts{};
 
-    // --- CORRECTION ICI ---
-    // Les cartes 'heightMap' et 'biomeMap' sont locales (16x16).
-    // Nous devons itérer de 0 à la taille de la carte, pas utiliser les coordonnées globales.
-
-    int mapHeight = static_cast<int>(heightMap.size());
-    if (mapHeight == 0) return data; // Sécurité
-    int mapWidth = static_cast<int>(heightMap[0].size());
-    if (mapWidth == 0) return data; // Sécurité
-
-    for (int z = 0; z < mapHeight; ++z) {
-        for (int x = 0; x < mapWidth; ++x) {
-            float h = heightMap[z][x];
+    for (int z = 0; z < depth; ++z) {
+        const float* heightRow = heights + z * heightStride;
+        const BiomeType* biomeRow = biomes + z * biomeStride;
+        for (int x = 0; x < width; ++x) {
+            float h = heightRow[x];
             minH = std::min(minH, h);
             maxH = std::max(maxH, h);
             sumH += h;
-            count++;
-
-            // Compte les biomes
-            if (z < static_cast<int>(biomeMap.size()) && x < static_cast<int>(biomeMap[z].size())) {
-                biomeCounts[biomeMap[z][x]]++;
-            }
+            biomeCounts[static_cast<size_t>(biomeRow[x])]++;
         }
     }
-    // --- FIN DE LA CORRECTION ---
 
+    data.averageHeight = sumH / (width * depth);
+    data.minHeight = minH;
+    data.maxHeight = maxH;
 
-    if (count > 0) {
-        data.averageHeight = sumH / count;
-        data.minHeight = minH;
-        data.maxHeight = maxH;
+    // Trouve le biome dominant (le premier en cas d'égalité)
+    data.dominantBiome = static_cast<int>(std::max_element(biomeCounts.begin(), biomeCounts.end()) - biomeCounts.begin());
 
-        // Trouve le biome dominant
-        int maxCount = 0;
-        for (const auto& pair : biomeCounts) {
-            if (pair.second > maxCount) {
-                maxCount = pair.second;
-                data.dominantBiome = pair.first;
-            }
-        }
-
-        // Couleur basée sur le biome et la hauteur
-        // TODO: Mapper les biomes aux couleurs
-        data.color = glm::vec3(0.5f, 0.5f, 0.5f); // Couleur par défaut
+    // Couleur basée sur le biome et la hauteur
+    // TODO: Mapper les biomes aux couleurs
+    data.color = glm::vec3(0.5f, 0.5f, 0.5f); // Couleur par défaut
 
-        // Échelle basée sur la variation de hauteur
-        float heightRange = maxH - minH;
-        data.scale = glm::vec3(16.0f, std::max(heightRange, 1.0f), 16.0f);
-    }
+    // Échelle basée sur la variation de hauteur
+    float heightRange = maxH - minH;
+    data.scale = glm::vec3(m_chunkSize, std::max(heightRange, 1.0f), m_chunkSize);
 
     return data;
 }
 
 uint64_t ChunkDataCache::getCacheKey(int chunkX, int chunkZ) {
-    // Combine chunkX et chunkZ en une clé 64-bit
-    return (static_cast<uint64_t>(chunkX) << 32) | static_cast<uint64_t>(chunkZ);
+    return GridKey(chunkX, chunkZ);
 }
 
 }
\ No newline at end of file
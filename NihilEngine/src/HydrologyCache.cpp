@@ -0,0 +1,133 @@
+#include <NihilEngine/HydrologyCache.h>
+#include <NihilEngine/GridMath.h>
+#include <algorithm>
+
+namespace NihilEngine {
+
+HydrologyCache::HydrologyCache(TerrainTileCache& tiles, const TerrainGenerator& terrainGen, const WaterGenerator& waterGen,
+                               size_t maxDomains)
+    : m_tiles(tiles), m_terrainGen(terrainGen), m_waterGen(waterGen),
+      m_maxDomains(std::max<size_t>(maxDomains, 1)), m_terrainRevision(terrainGen.getRevision()) {}
+
+std::vector<WaterBody> HydrologyCache::getTileLakes(int tileX, int tileZ) {
+    int domainX = FloorDiv(tileX, DOMAIN_TILES);
+    int domainZ = FloorDiv(tileZ, DOMAIN_TILES);
+    std::shared_ptr<const Domain> domain = getDomain(domainX, domainZ);
+    return domain->lakes[(tileX - domainX * DOMAIN_TILES) + (tileZ - domainZ * DOMAIN_TILES) * DOMAIN_TILES];
+}
+
+RiverTile HydrologyCache::getTileRivers(int tileX, int tileZ) {
+    const int tileSize = TerrainTileCache::TILE_SIZE;
+    int domainX = FloorDiv(tileX, DOMAIN_TILES);
+    int domainZ = FloorDiv(tileZ, DOMAIN_TILES);
+    std::shared_ptr<const Domain> domain = getDomain(domainX, domainZ);
+
+    RiverTile tile;
+    tile.originX = tileX * tileSize;
+    tile.originZ = tileZ * tileSize;
+    tile.widths.assign(static_cast<size_t>(tileSize) * tileSize, 0.0f);
+    for (const RiverCell& cell : domain->rivers[(tileX - domainX * DOMAIN_TILES) + (tileZ - domainZ * DOMAIN_TILES) * DOMAIN_TILES]) {
+        tile.widths[cell.index] = cell.width;
+    }
+    return tile;
+}
+
+size_t HydrologyCache::getDomainCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_domains.size();
+}
+
+void HydrologyCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_domains.clear();
+    m_lru.clear();
+}
+
+std::shared_ptr<const HydrologyCache::Domain> HydrologyCache::getDomain(int domainX, int domainZ) {
+    uint64_t key = GridKey(domainX, domainZ);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        invalidateIfStale();
+
+        auto it = m_domains.find(key);
+        if (it != m_domains.end()) {
+            m_lru.splice(m_lru.begin(), m_lru, it->second.lruPosition);
+            return it->second.domain;
+        }
+    }
+
+    // Calcul hors verrou (déterministe : un calcul concurrent du même domaine donne le même résultat)
+    unsigned int terrainRevision = m_terrainGen.getRevision();
+    std::shared_ptr<const Domain> domain = solveDomain(domainX, domainZ);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    invalidateIfStale();
+    if (terrainRevision != m_terrainRevision) {
+        return domain; // Terrain changé pendant le calcul : servi une fois, pas conservé
+    }
+    auto inserted = m_domains.emplace(key, Entry{domain, m_lru.end()});
+    if (inserted.second) {
+        m_lru.push_front(key);
+        inserted.first->second.lruPosition = m_lru.begin();
+        evictToCapacity();
+    }
+    return inserted.first->second.domain;
+}
+
+std::shared_ptr<const HydrologyCache::Domain> HydrologyCache::solveDomain(int domainX, int domainZ) const {
+    const int tileSize = TerrainTileCache::TILE_SIZE;
+    const int originX = domainX * DOMAIN_SIZE;
+    const int originZ = domainZ * DOMAIN_SIZE;
+
+    std::vector<float> heights(static_cast<size_t>(DOMAIN_SIZE) * DOMAIN_SIZE);
+    m_tiles.getRegion(heights.data(), DOMAIN_SIZE, nullptr, 0, originX, originZ, DOMAIN_SIZE, DOMAIN_SIZE);
+
+    // Remplissage par tuiles du cache : bassins reliés à travers les coutures par le graphe de débordement
+    std::vector<float> filled;
+    WaterGenerator::fillDepressionsTiled(heights.data(), DOMAIN_SIZE, DOMAIN_SIZE, DOMAIN_SIZE, tileSize, filled);
+
+    auto domain = std::make_shared<Domain>();
+    domain->lakes.resize(DOMAIN_TILES * DOMAIN_TILES);
+    domain->rivers.resize(DOMAIN_TILES * DOMAIN_TILES);
+
+    std::vector<glm::ivec2> lowestCells;
+    std::vector<WaterBody> lakes = m_waterGen.findLakes(heights.data(), DOMAIN_SIZE, DOMAIN_SIZE, DOMAIN_SIZE, filled,
+                                                        originX, originZ, 1.0f, &lowestCells);
+    for (size_t k = 0; k < lakes.size(); ++k) {
+        int tileX = (lowestCells[k].x - originX) / tileSize;
+        int tileZ = (lowestCells[k].y - originZ) / tileSize;
+        domain->lakes[tileX + tileZ * DOMAIN_TILES].push_back(std::move(lakes[k]));
+    }
+
+    // Débit accumulé sur tout le domaine : continu à travers les coutures de tuiles
+    std::vector<int> receivers;
+    std::vector<float> flow;
+    RiverGenerator::routeFlow(filled.data(), DOMAIN_SIZE, DOMAIN_SIZE, receivers, flow);
+    for (int z = 0; z < DOMAIN_SIZE; ++z) {
+        for (int x = 0; x < DOMAIN_SIZE; ++x) {
+            size_t index = static_cast<size_t>(x) + static_cast<size_t>(z) * DOMAIN_SIZE;
+            if (flow[index] < RiverGenerator::MIN_RIVER_FLOW || heights[index] < 0.0f) continue; // Pas de rivière sous l'océan
+            domain->rivers[x / tileSize + (z / tileSize) * DOMAIN_TILES].push_back(
+                {x % tileSize + (z % tileSize) * tileSize, RiverGenerator::riverWidth(flow[index])});
+        }
+    }
+    return domain;
+}
+
+void HydrologyCache::invalidateIfStale() {
+    unsigned int terrainRevision = m_terrainGen.getRevision();
+    if (terrainRevision != m_terrainRevision) {
+        m_domains.clear();
+        m_lru.clear();
+        m_terrainRevision = terrainRevision;
+    }
+}
+
+void HydrologyCache::evictToCapacity() {
+    while (m_domains.size() > m_maxDomains) {
+        m_domains.erase(m_lru.back());
+        m_lru.pop_back();
+    }
+}
+
+}
@@ -1,6 +1,7 @@
 // NihilEngine/src/Mesh.cpp
 #include <NihilEngine/Mesh.h>
 #include <glad/glad.h>
+#include <algorithm>
 #include <iostream>
 
 namespace NihilEngine {
@@ -9,107 +10,198 @@ namespace NihilEngine {
     // MESH IMPLEMENTATION
     // ============================================================
 
+    namespace {
+        // Nombre de composantes de 4 octets (float ou uint32) occupées par un attribut
+        int GetComponentCount(VertexAttribute attr) {
+            switch (attr) {
+                case VertexAttribute::Position:    return 3;
+                case VertexAttribute::Normal:      return 3;
+                case VertexAttribute::TexCoord:    return 2;
+                case VertexAttribute::Color:       return 4;
+                case VertexAttribute::PackedVoxel: return 1;
+            }
+            return 0;
+        }
+
+        // Emplacement fixe de chaque attribut dans les shaders (un mesh peut en omettre)
+        GLuint GetAttributeLocation(VertexAttribute attr) {
+            switch (attr) {
+                case VertexAttribute::Position:    return 0;
+                case VertexAttribute::Normal:      return 1;
+                case VertexAttribute::TexCoord:    return 2;
+                case VertexAttribute::Color:       return 3;
+                case VertexAttribute::PackedVoxel: return 0;
+            }
+            return 0;
+        }
+    }
+
+    namespace {
+        // Tampons d'indices de quads partagés par tous les meshes de voxels (0,1,2, 2,3,0 par quad).
+        // Le nom du tampon ne change jamais : l'agrandir ne casse pas les VAO qui le référencent.
+        constexpr size_t MAX_QUADS_16BIT = 65536 / 4;
+
+        struct SharedQuadIndexBuffer {
+            GLuint buffer = 0;
+            size_t quadCapacity = 0;
+        };
+
+        SharedQuadIndexBuffer g_QuadIndices16;
+        SharedQuadIndexBuffer g_QuadIndices32;
+
+        template <typename IndexT>
+        void GrowQuadIndexBuffer(SharedQuadIndexBuffer& shared, size_t quadCount, size_t maxQuads) {
+            if (shared.buffer == 0) glGenBuffers(1, &shared.buffer);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, shared.buffer);
+            if (quadCount <= shared.quadCapacity) return;
+
+            size_t capacity = std::max<size_t>(shared.quadCapacity * 2, 1024);
+            capacity = std::min(std::max(capacity, quadCount), maxQuads);
+
+            std::vector<IndexT> indices(capacity * 6);
+            for (size_t quad = 0; quad < capacity; ++quad) {
+                IndexT base = static_cast<IndexT>(quad * 4);
+                IndexT* out = &indices[quad * 6];
+                out[0] = base;     out[1] = base + 1; out[2] = base + 2;
+                out[3] = base + 2; out[4] = base + 3; out[5] = base;
+            }
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(IndexT), indices.data(), GL_STATIC_DRAW);
+            shared.quadCapacity = capacity;
+        }
+
+        // Attache au VAO courant un tampon partagé couvrant quadCount quads (16 bits si possible)
+        GLuint BindSharedQuadIndexBuffer(size_t quadCount, GLenum& indexType) {
+            if (quadCount <= MAX_QUADS_16BIT) {
+                GrowQuadIndexBuffer<uint16_t>(g_QuadIndices16, quadCount, MAX_QUADS_16BIT);
+                indexType = GL_UNSIGNED_SHORT;
+                return g_QuadIndices16.buffer;
+            }
+            GrowQuadIndexBuffer<uint32_t>(g_QuadIndices32, quadCount, quadCount);
+            indexType = GL_UNSIGNED_INT;
+            return g_QuadIndices32.buffer;
+        }
+    }
+
     Mesh::Mesh(const std::vector<float>& vertices,
             const std::vector<unsigned int>& indices,
-            const std::vector<VertexAttribute>& attributes)
-        : m_IndexCount(static_cast<int>(indices.size())) {
-
+            const std::vector<VertexAttribute>& attributes) {
         // *** CORRECTION AJOUTÉE : GESTION DES MESH VIDES ***
         // Si les vertices ou indices sont vides, ne pas essayer de créer de buffers OpenGL.
         if (vertices.empty() || indices.empty()) {
-            m_VAO = m_VBO = m_EBO = 0;
-            m_IndexCount = 0;
             return; // Quitte le constructeur
         }
         // *** FIN DE LA CORRECTION ***
 
+        Upload(vertices.data(), vertices.size(), attributes);
+
+        glGenBuffers(1, &m_EBO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+        m_OwnsIndexBuffer = true;
+        m_IndexCount = static_cast<int>(indices.size());
+
+        glBindVertexArray(0);
+    }
+
+    Mesh::Mesh(const std::vector<uint32_t>& vertices, const std::vector<VertexAttribute>& attributes) {
+        int componentsPerVertex = 0;
+        for (auto attr : attributes) {
+            componentsPerVertex += GetComponentCount(attr);
+        }
+        size_t quadCount = componentsPerVertex > 0 ? vertices.size() / componentsPerVertex / 4 : 0;
+        if (quadCount == 0) {
+            return; // Mesh vide
+        }
+
+        Upload(vertices.data(), vertices.size(), attributes);
+
+        m_EBO = BindSharedQuadIndexBuffer(quadCount, m_IndexType);
+        m_IndexCount = static_cast<int>(quadCount * 6);
+
+        glBindVertexArray(0);
+    }
+
+    void Mesh::Upload(const void* vertexData, size_t componentCount, const std::vector<VertexAttribute>& attributes) {
+        for (auto attr : attributes) {
+            if (attr == VertexAttribute::PackedVoxel) m_PackedVoxel = true;
+        }
+
         // Debug/sanity check: verify vertex buffer matches declared attributes
-        int floatsPerVertex = 0;
+        int componentsPerVertex = 0;
         for (auto attr : attributes) {
-            switch (attr) {
-                case VertexAttribute::Position: floatsPerVertex += 3; break;
-                case VertexAttribute::Normal:   floatsPerVertex += 3; break;
-                case VertexAttribute::TexCoord: floatsPerVertex += 2; break;
-                case VertexAttribute::Color:    floatsPerVertex += 4; break;
-            }
+            componentsPerVertex += GetComponentCount(attr);
         }
-        if (floatsPerVertex > 0 && (vertices.size() % floatsPerVertex) != 0) {
-            std::cerr << "[Mesh] Vertex buffer size (" << vertices.size()
+        if (componentsPerVertex > 0 && (componentCount % componentsPerVertex) != 0) {
+            std::cerr << "[Mesh] Vertex buffer size (" << componentCount
                       << ") is not a multiple of attribute stride ("
-                      << floatsPerVertex << "). Data may be misaligned.\n";
+                      << componentsPerVertex << "). Data may be misaligned.\n";
         }
 
         glGenVertexArrays(1, &m_VAO);
         glGenBuffers(1, &m_VBO);
-        glGenBuffers(1, &m_EBO);
 
         glBindVertexArray(m_VAO);
 
+        // float et uint32 occupent tous deux 4 octets
         glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
-        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
-
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, componentCount * sizeof(float), vertexData, GL_STATIC_DRAW);
 
         SetupAttributes(attributes);
-
-        glBindVertexArray(0);
+        // Le VAO reste lié : l'appelant y attache le tampon d'indices
     }
 
     void Mesh::SetupAttributes(const std::vector<VertexAttribute>& attributes) {
         int stride = 0;
         for (auto attr : attributes) {
-            switch (attr) {
-                case VertexAttribute::Position: stride += 3; break;
-                case VertexAttribute::Normal:   stride += 3; break;
-                case VertexAttribute::TexCoord: stride += 2; break;
-                case VertexAttribute::Color:    stride += 4; break;
-            }
+            stride += GetComponentCount(attr);
         }
-        stride *= sizeof(float);
+        stride *= sizeof(float); // float et uint32 : 4 octets
 
         int offset = 0;
-        int location = 0;
         for (auto attr : attributes) {
-            int size = 0;
-            switch (attr) {
-                case VertexAttribute::Position: size = 3; break;
-                case VertexAttribute::Normal:   size = 3; break;
-                case VertexAttribute::TexCoord: size = 2; break;
-                case VertexAttribute::Color:    size = 4; break;
+            int size = GetComponentCount(attr);
+            GLuint location = GetAttributeLocation(attr);
+            if (attr == VertexAttribute::PackedVoxel) {
+                // Attribut entier : pas de conversion en float, lu comme uint dans le shader
+                glVertexAttribIPointer(location, size, GL_UNSIGNED_INT, stride, (void*)(offset * sizeof(float)));
+            } else {
+                glVertexAttribPointer(location, size, GL_FLOAT, GL_FALSE, stride, (void*)(offset * sizeof(float)));
             }
-            glVertexAttribPointer(location, size, GL_FLOAT, GL_FALSE, stride, (void*)(offset * sizeof(float)));
             glEnableVertexAttribArray(location);
             offset += size;
-            location++;
         }
     }
 
     Mesh::~Mesh() {
+        Release();
+    }
+
+    void Mesh::Release() {
         if (m_VAO != 0) { // Ne pas essayer de supprimer si m_VAO est 0 (mesh vide)
             glDeleteVertexArrays(1, &m_VAO);
             glDeleteBuffers(1, &m_VBO);
-            glDeleteBuffers(1, &m_EBO);
+            if (m_OwnsIndexBuffer) glDeleteBuffers(1, &m_EBO); // Le tampon de quads partagé est conservé
         }
     }
 
     Mesh::Mesh(Mesh&& other) noexcept
-        : m_VAO(other.m_VAO), m_VBO(other.m_VBO), m_EBO(other.m_EBO), m_IndexCount(other.m_IndexCount) {
+        : m_VAO(other.m_VAO), m_VBO(other.m_VBO), m_EBO(other.m_EBO), m_IndexCount(other.m_IndexCount),
+          m_IndexType(other.m_IndexType), m_OwnsIndexBuffer(other.m_OwnsIndexBuffer),
+          m_PackedVoxel(other.m_PackedVoxel) {
         other.m_VAO = other.m_VBO = other.m_EBO = 0;
         other.m_IndexCount = 0;
     }
 
     Mesh& Mesh::operator=(Mesh&& other) noexcept {
         if (this != &other) {
-            if (m_VAO != 0) {
-                glDeleteVertexArrays(1, &m_VAO);
-                glDeleteBuffers(1, &m_VBO);
-                glDeleteBuffers(1, &m_EBO);
-            }
+            Release();
             m_VAO = other.m_VAO;
             m_VBO = other.m_VBO;
             m_EBO = other.m_EBO;
             m_IndexCount = other.m_IndexCount;
+            m_IndexType = other.m_IndexType;
+            m_OwnsIndexBuffer = other.m_OwnsIndexBuffer;
+            m_PackedVoxel = other.m_PackedVoxel;
 
             other.m_VAO = other.m_VBO = other.m_EBO = 0;
             other.m_IndexCount = 0;
@@ -123,10 +215,17 @@ namespace NihilEngine {
     void Mesh::Draw() const   {
         // Sécurité pour ne pas dessiner un mesh vide
         if (m_VAO != 0 && m_IndexCount > 0) {
-            glDrawElements(GL_TRIANGLES, m_IndexCount, GL_UNSIGNED_INT, 0);
+            glDrawElements(GL_TRIANGLES, m_IndexCount, m_IndexType, 0);
         }
     }
 
+    void Mesh::DrawRange(const MeshRange& range) const {
+        if (m_VAO == 0 || range.indexCount <= 0) return;
+
+        size_t indexSize = m_IndexType == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t);
+        glDrawElements(GL_TRIANGLES, range.indexCount, m_IndexType, (void*)(range.firstIndex * indexSize));
+    }
+
     // *** CORRECTION AJOUTÉE : Implémentation ***
     int Mesh::GetIndexCount() const {
         return m_IndexCount;
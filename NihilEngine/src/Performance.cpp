@@ -19,6 +19,33 @@ void LODManager::addLODLevel(float distance, float detailLevel) {
               [](const LODLevel& a, const LODLevel& b) { return a.distance < b.distance; });
 }
 
+void LODManager::clearLODLevels() {
+    m_LODLevels.clear();
+}
+
+int LODManager::getLevelIndex(float distance, int currentLevel, float hysteresis) const {
+    int levelCount = static_cast<int>(m_LODLevels.size());
+
+    // Le niveau courant couvre ]seuil précédent, son seuil], élargi de l'hystérésis des deux côtés
+    if (currentLevel >= 0 && currentLevel <= levelCount) {
+        bool aboveLower = currentLevel == 0 || distance > m_LODLevels[currentLevel - 1].distance - hysteresis;
+        bool belowUpper = currentLevel == levelCount || distance <= m_LODLevels[currentLevel].distance + hysteresis;
+        if (aboveLower && belowUpper) return currentLevel;
+    }
+
+    int level = 0;
+    while (level < levelCount && distance > m_LODLevels[level].distance) {
+        ++level;
+    }
+    return level;
+}
+
+float LODManager::getLevelDetail(int level) const {
+    if (m_LODLevels.empty()) return 1.0f;
+    if (level < static_cast<int>(m_LODLevels.size())) return m_LODLevels[std::max(level, 0)].detailLevel;
+    return m_LODLevels.back().detailLevel * 0.5f;
+}
+
 float LODManager::getDetailLevel(const glm::vec3& position, const glm::vec3& cameraPosition) const {
     float distance = glm::distance(position, cameraPosition);
 
@@ -1,4 +1,5 @@
 #include <NihilEngine/ProceduralGenerator.h>
+#include <algorithm>
 
 namespace NihilEngine {
 
@@ -9,14 +10,29 @@ ProceduralGenerator::ProceduralGenerator(unsigned int seed) : seed(seed) {
 std::unique_ptr<ProceduralWorld> ProceduralGenerator::generateWorld(int width, int height, float scale) {
     auto world = std::make_unique<ProceduralWorld>();
 
-    // 1. Génère le terrain de base
-    world->heightMap = terrainGen->generateHeightMap(width, height, scale);
-
-    // 2. Génère les biomes
-    world->biomeMap = biomeGen->generateBiomeMap(width, height, scale, world->heightMap);
+    // 1-2. Terrain de base et biomes en une passe chacun, dans des tampons contigus
+    // (à l'échelle 1, lus à travers les tuiles partagées : les rivières relisent les mêmes colonnes)
+    const size_t stride = static_cast<size_t>(std::max(width, 0));
+    std::vector<float> heights(stride * std::max(height, 0));
+    std::vector<BiomeType> biomes(heights.size());
+    if (scale == 1.0f) {
+        tileCache->getRegion(heights.data(), stride, biomes.data(), stride, 0, 0, width, height);
+    } else {
+        terrainGen->getHeightRegion(heights.data(), stride, width, height, 0.0f, 0.0f, scale);
+        biomeGen->getBiomeRegion(biomes.data(), stride, width, height, 0.0f, 0.0f, scale, heights.data(), stride);
+    }
+
+    // Les étapes suivantes travaillent sur des cartes par lignes
+    world->heightMap.resize(height);
+    world->biomeMap.resize(height);
+    for (int z = 0; z < height; ++z) {
+        size_t row = static_cast<size_t>(z) * stride;
+        world->heightMap[z].assign(heights.begin() + row, heights.begin() + row + stride);
+        world->biomeMap[z].assign(biomes.begin() + row, biomes.begin() + row + stride);
+    }
 
     // 3. Génère les rivières et modifie le terrain
-    world->rivers = riverGen->generateRivers(width, height, scale, *terrainGen);
+    world->rivers = riverGen->generateRivers(width, height, scale, *tileCache);
     riverGen->carveRivers(world->heightMap, world->rivers, scale);
 
     // 4. Génère les corps d'eau
@@ -40,6 +56,8 @@ void ProceduralGenerator::initializeGenerators() {
     riverGen = std::make_unique<RiverGenerator>(seed);
     vegGen = std::make_unique<VegetationGenerator>(seed);
     waterGen = std::make_unique<WaterGenerator>(seed);
+    tileCache = std::make_unique<TerrainTileCache>(*terrainGen, *biomeGen);
+    hydrology = std::make_unique<HydrologyCache>(*tileCache, *terrainGen, *waterGen);
 }
 
 }
\ No newline at end of file
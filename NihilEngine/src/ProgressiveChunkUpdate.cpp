@@ -1,4 +1,5 @@
 #include <NihilEngine/ProgressiveChunkUpdate.h>
+#include <NihilEngine/GridMath.h>
 #include <algorithm>
 #include <chrono>
 
@@ -111,7 +112,7 @@ void ProgressiveChunkUpdate::resetProcessedUpdatesCount() {
 }
 
 uint64_t ProgressiveChunkUpdate::getChunkKey(int chunkX, int chunkZ) const {
-    return (static_cast<uint64_t>(chunkX) << 32) | static_cast<uint64_t>(chunkZ);
+    return GridKey(chunkX, chunkZ);
 }
 
 }
\ No newline at end of file
@@ -18,10 +18,13 @@ namespace NihilEngine {
         layout (location = 0) in vec3 aPos;
         layout (location = 1) in vec3 aNormal;
         layout (location = 2) in vec2 aUv;
+        layout (location = 3) in vec4 aColor; // Blanc pour les meshes sans couleur de sommet
 
         out vec3 v_FragPos;
         out vec3 v_Normal;
         out vec2 v_Uv;
+        out vec4 v_Color;
+        flat out vec4 v_Tile;
 
         uniform mat4 u_Model;
         uniform mat4 u_ViewProjection;
@@ -32,6 +35,56 @@ namespace NihilEngine {
             v_FragPos = worldPos.xyz;
             v_Normal = mat3(transpose(inverse(u_Model))) * aNormal;
             v_Uv = aUv;
+            v_Color = aColor;
+            v_Tile = vec4(0.0); // UV directes
+        }
+    )";
+
+    // Chunks : un uint32 par sommet (voir PackVoxelVertex), la normale et les UV sont déduites
+    const char* chunkVertexShaderSource = R"(
+        #version 330 core
+        layout (location = 0) in uint aPacked;
+
+        out vec3 v_FragPos;
+        out vec3 v_Normal;
+        out vec2 v_Uv;
+        out vec4 v_Color;
+        flat out vec4 v_Tile;
+
+        uniform mat4 u_Model;
+        uniform mat4 u_ViewProjection;
+        uniform ivec2 u_AtlasGrid;
+        uniform float u_ChunkSize; // Décalage d'un emplacement de super-chunk (Renderer::SetVoxelChunkSize)
+
+        const vec3 FACE_NORMALS[6] = vec3[6](
+            vec3(0.0, 0.0, 1.0), vec3(0.0, 0.0, -1.0),
+            vec3(-1.0, 0.0, 0.0), vec3(1.0, 0.0, 0.0),
+            vec3(0.0, 1.0, 0.0), vec3(0.0, -1.0, 0.0)
+        );
+
+        void main() {
+            vec3 localPos = vec3(float(aPacked & 31u), float((aPacked >> 10) & 511u), float((aPacked >> 5) & 31u));
+            localPos.xz += vec2(float((aPacked >> 30) & 1u), float(aPacked >> 31)) * u_ChunkSize; // Emplacement de super-chunk
+            uint face = (aPacked >> 19) & 7u;
+            uint tile = (aPacked >> 22) & 255u;
+
+            vec4 worldPos = u_Model * vec4(localPos, 1.0);
+            gl_Position = u_ViewProjection * worldPos;
+            v_FragPos = worldPos.xyz;
+            v_Normal = FACE_NORMALS[face]; // Les chunks ne sont que translatés
+            v_Color = vec4(1.0);
+
+            // UV en nombre de tuiles, projetées sur le plan de la face (même orientation qu'un bloc isolé)
+            if (face == 0u)      v_Uv = vec2( localPos.x, localPos.y);
+            else if (face == 1u) v_Uv = vec2(-localPos.x, localPos.y);
+            else if (face == 2u) v_Uv = vec2(-localPos.z, localPos.y);
+            else if (face == 3u) v_Uv = vec2( localPos.z, localPos.y);
+            else if (face == 4u) v_Uv = vec2( localPos.x, -localPos.z);
+            else                 v_Uv = vec2( localPos.x, localPos.z);
+
+            vec2 tileSize = 1.0 / vec2(u_AtlasGrid);
+            uint columns = uint(u_AtlasGrid.x);
+            v_Tile = vec4(vec2(float(tile % columns), float(tile / columns)) * tileSize, tileSize);
         }
     )";
 
@@ -40,6 +93,8 @@ namespace NihilEngine {
         in vec3 v_FragPos;
         in vec3 v_Normal;
         in vec2 v_Uv;
+        in vec4 v_Color;
+        flat in vec4 v_Tile;
         out vec4 FragColor;
 
         uniform vec3 u_ViewPos;
@@ -52,9 +107,11 @@ namespace NihilEngine {
         uniform vec3 u_LightPos;
 
         void main() {
-            vec4 baseColor = u_Color;
+            vec4 baseColor = u_Color * v_Color;
             if (u_HasTexture) {
-                baseColor *= texture(u_Texture, v_Uv);
+                // Chunks : v_Uv compte en tuiles, répétées dans la tuile d'atlas
+                vec2 uv = v_Tile.z > 0.0 ? v_Tile.xy + fract(v_Uv) * v_Tile.zw : v_Uv;
+                baseColor *= texture(u_Texture, uv);
             }
 
             // Ambient
@@ -123,6 +180,8 @@ namespace NihilEngine {
 
     Renderer::Renderer() {
         glEnable(GL_DEPTH_TEST);
+        // Valeur de aColor (emplacement 3) quand le mesh n'a pas de couleur de sommet
+        glVertexAttrib4f(3, 1.0f, 1.0f, 1.0f, 1.0f);
         InitShaders();
         InitCrosshair();
         InitLineShader();
@@ -131,6 +190,7 @@ namespace NihilEngine {
 
     Renderer::~Renderer() {
         glDeleteProgram(m_ShaderProgram);
+        glDeleteProgram(m_ChunkShaderProgram);
         glDeleteProgram(m_CrosshairShaderProgram);
         glDeleteProgram(m_LineShaderProgram);
 
@@ -176,7 +236,32 @@ namespace NihilEngine {
             std::cerr << "Shader program linking failed: " << infoLog << std::endl;
         }
 
+        // Programme des chunks : sommets empaquetés, même fragment shader
+        GLuint chunkVertex = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(chunkVertex, 1, &chunkVertexShaderSource, nullptr);
+        glCompileShader(chunkVertex);
+
+        glGetShaderiv(chunkVertex, GL_COMPILE_STATUS, &success);
+        if (!success) {
+            char infoLog[512];
+            glGetShaderInfoLog(chunkVertex, 512, nullptr, infoLog);
+            std::cerr << "Chunk vertex shader compilation failed: " << infoLog << std::endl;
+        }
+
+        m_ChunkShaderProgram = glCreateProgram();
+        glAttachShader(m_ChunkShaderProgram, chunkVertex);
+        glAttachShader(m_ChunkShaderProgram, fragment);
+        glLinkProgram(m_ChunkShaderProgram);
+
+        glGetProgramiv(m_ChunkShaderProgram, GL_LINK_STATUS, &success);
+        if (!success) {
+            char infoLog[512];
+            glGetProgramInfoLog(m_ChunkShaderProgram, 512, nullptr, infoLog);
+            std::cerr << "Chunk shader program linking failed: " << infoLog << std::endl;
+        }
+
         glDeleteShader(vertex);
+        glDeleteShader(chunkVertex);
         glDeleteShader(fragment);
     }
 
@@ -269,39 +354,68 @@ namespace NihilEngine {
     }
 
     void Renderer::DrawEntity(const Entity& entity, const Camera& camera) {
-        glUseProgram(m_ShaderProgram);
+        bool hasTexture = BeginEntity(entity, camera);
+
+        const Mesh& mesh = entity.GetMesh();
+        mesh.Bind();
+        mesh.Draw();
+        mesh.Unbind();
+
+        if (hasTexture) {
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }
+    }
+
+    void Renderer::DrawEntity(const Entity& entity, const Camera& camera, const MeshRange* ranges, size_t rangeCount) {
+        if (rangeCount == 0) return;
+        bool hasTexture = BeginEntity(entity, camera);
+
+        const Mesh& mesh = entity.GetMesh();
+        mesh.Bind();
+        for (size_t i = 0; i < rangeCount; ++i) {
+            mesh.DrawRange(ranges[i]);
+        }
+        mesh.Unbind();
+
+        if (hasTexture) {
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }
+    }
+
+    bool Renderer::BeginEntity(const Entity& entity, const Camera& camera) {
+        const Mesh& mesh = entity.GetMesh();
+        GLuint program = mesh.IsPackedVoxel() ? m_ChunkShaderProgram : m_ShaderProgram;
+        glUseProgram(program);
 
         glm::mat4 vp = camera.GetViewProjectionMatrix();
-        glUniformMatrix4fv(glGetUniformLocation(m_ShaderProgram, "u_ViewProjection"), 1, GL_FALSE, glm::value_ptr(vp));
-        glUniformMatrix4fv(glGetUniformLocation(m_ShaderProgram, "u_Model"), 1, GL_FALSE, glm::value_ptr(entity.GetModelMatrix()));
-        glUniform3fv(glGetUniformLocation(m_ShaderProgram, "u_ViewPos"), 1, glm::value_ptr(camera.GetPosition()));
+        glUniformMatrix4fv(glGetUniformLocation(program, "u_ViewProjection"), 1, GL_FALSE, glm::value_ptr(vp));
+        glUniformMatrix4fv(glGetUniformLocation(program, "u_Model"), 1, GL_FALSE, glm::value_ptr(entity.GetModelMatrix()));
+        glUniform3fv(glGetUniformLocation(program, "u_ViewPos"), 1, glm::value_ptr(camera.GetPosition()));
 
         // Set lighting uniforms
-        glUniform3f(glGetUniformLocation(m_ShaderProgram, "u_LightPos"), Constants::LIGHT_POS_X, Constants::LIGHT_POS_Y, Constants::LIGHT_POS_Z);
+        glUniform3f(glGetUniformLocation(program, "u_LightPos"), Constants::LIGHT_POS_X, Constants::LIGHT_POS_Y, Constants::LIGHT_POS_Z);
 
         // Set fog uniforms
-        glUniform1i(glGetUniformLocation(m_ShaderProgram, "u_FogEnabled"), m_FogEnabled);
-        glUniform3fv(glGetUniformLocation(m_ShaderProgram, "u_FogColor"), 1, glm::value_ptr(m_FogColor));
-        glUniform1f(glGetUniformLocation(m_ShaderProgram, "u_FogDensity"), m_FogDensity);
+        glUniform1i(glGetUniformLocation(program, "u_FogEnabled"), m_FogEnabled);
+        glUniform3fv(glGetUniformLocation(program, "u_FogColor"), 1, glm::value_ptr(m_FogColor));
+        glUniform1f(glGetUniformLocation(program, "u_FogDensity"), m_FogDensity);
+
+        if (mesh.IsPackedVoxel()) {
+            glUniform2i(glGetUniformLocation(program, "u_AtlasGrid"), Constants::ATLAS_COLUMNS, Constants::ATLAS_ROWS);
+            glUniform1f(glGetUniformLocation(program, "u_ChunkSize"), static_cast<float>(m_VoxelChunkSize));
+        }
 
         const auto& material = entity.GetMaterial();
-        glUniform4fv(glGetUniformLocation(m_ShaderProgram, "u_Color"), 1, glm::value_ptr(material.color));
+        glUniform4fv(glGetUniformLocation(program, "u_Color"), 1, glm::value_ptr(material.color));
         bool hasTexture = material.textureID.has_value();
-        glUniform1i(glGetUniformLocation(m_ShaderProgram, "u_HasTexture"), hasTexture);
+        glUniform1i(glGetUniformLocation(program, "u_HasTexture"), hasTexture);
 
         if (hasTexture) {
             glActiveTexture(GL_TEXTURE0);
             glBindTexture(GL_TEXTURE_2D, material.textureID.value());
-            glUniform1i(glGetUniformLocation(m_ShaderProgram, "u_Texture"), 0);
-        }
-
-        entity.GetMesh().Bind();
-        entity.GetMesh().Draw();
-        entity.GetMesh().Unbind();
-
-        if (hasTexture) {
-            glBindTexture(GL_TEXTURE_2D, 0);
+            glUniform1i(glGetUniformLocation(program, "u_Texture"), 0);
         }
+        return hasTexture;
     }
 
     void Renderer::DrawCrosshair(int windowWidth, int windowHeight) {
@@ -402,6 +516,10 @@ namespace NihilEngine {
         m_FogDensity = density;
     }
 
+    void Renderer::SetVoxelChunkSize(int size) {
+        m_VoxelChunkSize = size;
+    }
+
     // Particle methods
     void Renderer::AddParticle(const Particle& particle) {
         m_Particles.push_back(particle);
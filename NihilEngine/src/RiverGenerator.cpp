@@ -1,78 +1,178 @@
 #include <NihilEngine/RiverGenerator.h>
+#include <NihilEngine/WaterGenerator.h>
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <queue>
 
 namespace NihilEngine {
 
 RiverGenerator::RiverGenerator(unsigned int seed) : noise(seed + 3) {}
 
-std::vector<RiverPoint> RiverGenerator::generateRiver(const glm::vec2& startPos, const TerrainGenerator& terrainGen, float maxLength) {
-    std::vector<RiverPoint> river;
-    glm::vec2 currentPos = startPos;
-    float totalLength = 0.0f;
-    float currentWidth = 2.0f; // Largeur initiale
-    float currentDepth = 0.5f; // Profondeur initiale
-
-    river.push_back({currentPos, currentWidth, currentDepth});
-
-    while (totalLength < maxLength) {
-        // Trouve la direction vers le point le plus bas
-        glm::vec2 nextPos = findLowestNeighbor(currentPos, terrainGen);
-
-        // Calcule la distance
-        float distance = glm::distance(currentPos, nextPos);
-        if (distance < 0.1f) {
-            // Plus de pente, arrêt de la rivière
-            break;
+std::vector<std::vector<RiverPoint>> RiverGenerator::generateRivers(int width, int height, float scale,
+                                                                  TerrainTileCache& tiles, int numRivers) {
+    std::vector<std::vector<RiverPoint>> rivers;
+    if (width <= 0 || height <= 0) return rivers;
+
+    // Hauteurs lues dans les tuiles (une cellule de carte = le bloc qui la contient)
+    std::vector<float> heights(static_cast<size_t>(width) * height);
+    if (scale == 1.0f) {
+        tiles.getRegion(heights.data(), width, nullptr, 0, 0, 0, width, height);
+    } else {
+        for (int z = 0; z < height; ++z) {
+            for (int x = 0; x < width; ++x) {
+                heights[x + z * width] = tiles.getHeight(static_cast<int>(std::floor(x * scale)),
+                                                         static_cast<int>(std::floor(z * scale)));
+            }
         }
+    }
 
-        totalLength += distance;
-        currentPos = nextPos;
-
-        // Augmente légèrement la largeur et la profondeur au fur et à mesure
-        currentWidth += 0.1f;
-        currentDepth += 0.05f;
+    std::vector<int> receivers;
+    std::vector<float> flow;
+    computeFlow(heights.data(), width, width, height, receivers, flow);
 
-        // Limite les valeurs
-        currentWidth = std::min(currentWidth, 10.0f);
-        currentDepth = std::min(currentDepth, 3.0f);
+    // Embouchures : rivières émergées qui se jettent dans l'océan ou sortent de la carte
+    std::vector<int> mouths;
+    for (int index = 0; index < width * height; ++index) {
+        if (flow[index] < MIN_RIVER_FLOW || heights[index] < 0.0f) continue;
+        int receiver = receivers[index];
+        if (receiver < 0 || heights[receiver] < 0.0f) mouths.push_back(index);
+    }
 
-        river.push_back({currentPos, currentWidth, currentDepth});
+    // Les plus grands débits d'abord (égalités par indice : résultat déterministe)
+    std::sort(mouths.begin(), mouths.end(), [&](int a, int b) {
+        return flow[a] != flow[b] ? flow[a] > flow[b] : a < b;
+    });
+
+    for (int mouth : mouths) {
+        if (static_cast<int>(rivers.size()) >= numRivers) break;
+
+        // Remonte le bras principal : à chaque confluence, l'affluent au plus fort débit
+        std::vector<RiverPoint> river;
+        int current = mouth;
+        while (current >= 0) {
+            const int x = current % width;
+            const int z = current / width;
+            river.push_back({glm::vec2(x, z) * scale, riverWidth(flow[current]), riverDepth(flow[current])});
+
+            int upstream = -1;
+            for (int dz = -1; dz <= 1; ++dz) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    int nx = x + dx;
+                    int nz = z + dz;
+                    if ((dx == 0 && dz == 0) || nx < 0 || nz < 0 || nx >= width || nz >= height) continue;
+                    int donor = nx + nz * width;
+                    if (receivers[donor] != current || flow[donor] < MIN_RIVER_FLOW) continue;
+                    if (upstream < 0 || flow[donor] > flow[upstream] || (flow[donor] == flow[upstream] && donor < upstream)) {
+                        upstream = donor;
+                    }
+                }
+            }
+            current = upstream;
+        }
 
-        // Arrêt si on atteint un océan ou une hauteur très basse
-        if (terrainGen.getHeight(currentPos.x, currentPos.y) < -1.0f) {
-            break;
+        // De la source à l'embouchure
+        std::reverse(river.begin(), river.end());
+        if (river.size() > 10) { // Garde seulement les rivières significatives
+            rivers.push_back(std::move(river));
         }
     }
 
-    return river;
+    return rivers;
 }
 
-std::vector<std::vector<RiverPoint>> RiverGenerator::generateRivers(int width, int height, float scale,
-                                                                  const TerrainGenerator& terrainGen, int numRivers) {
-    std::vector<std::vector<RiverPoint>> rivers;
-
-    for (int i = 0; i < numRivers; ++i) {
-        // Choisit un point de départ aléatoire dans les hauteurs
-        float startX = noise.perlin2D(i * 10.0f, 0.0f) * width * scale;
-        float startZ = noise.perlin2D(0.0f, i * 10.0f) * height * scale;
-
-        // S'assure que le point de départ est dans les limites et assez haut
-        startX = std::clamp(startX, scale * 10.0f, scale * (width - 10.0f));
-        startZ = std::clamp(startZ, scale * 10.0f, scale * (height - 10.0f));
-
-        glm::vec2 startPos(startX, startZ);
+void RiverGenerator::computeFlow(const float* heights, size_t stride, int width, int depth,
+                                 std::vector<int>& receivers, std::vector<float>& flow) {
+    // Les pentes du remplissage mènent toujours à un bord, y compris à travers lacs et plats
+    std::vector<float> filled;
+    WaterGenerator::fillDepressions(heights, stride, width, depth, filled);
+    routeFlow(filled.data(), width, depth, receivers, flow);
+}
 
-        // Vérifie que la hauteur est suffisante pour une source de rivière
-        if (terrainGen.getHeight(startPos.x, startPos.y) > 5.0f) {
-            auto river = generateRiver(startPos, terrainGen);
-            if (!river.empty() && river.size() > 10) { // Garde seulement les rivières significatives
-                rivers.push_back(river);
+void RiverGenerator::routeFlow(const float* filled, int width, int depth,
+                               std::vector<int>& receivers, std::vector<float>& flow) {
+    const size_t count = static_cast<size_t>(width) * depth;
+    receivers.assign(count, -1);
+    flow.assign(count, 1.0f);
+    if (count == 0) return;
+
+    static const int DX[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+    static const int DZ[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
+    const float DIAGONAL = 1.0f / std::sqrt(2.0f);
+
+    // Plus forte pente vers un voisin strictement plus bas (dénivelé divisé par la distance) ;
+    // les bords sont les exutoires, les cellules sans voisin plus bas sont des plats à résoudre
+    std::vector<uint8_t> resolved(count, 0);
+    std::queue<int> flats;
+    for (int z = 0; z < depth; ++z) {
+        for (int x = 0; x < width; ++x) {
+            int index = x + z * width;
+            if (x == 0 || z == 0 || x == width - 1 || z == depth - 1) {
+                resolved[index] = 1;
+                flats.push(index);
+                continue;
+            }
+            float steepest = 0.0f;
+            for (int k = 0; k < 8; ++k) {
+                int neighbor = (x + DX[k]) + (z + DZ[k]) * width;
+                float slope = (filled[index] - filled[neighbor]) * (DX[k] != 0 && DZ[k] != 0 ? DIAGONAL : 1.0f);
+                if (slope > steepest) {
+                    steepest = slope;
+                    receivers[index] = neighbor;
+                }
+            }
+            if (receivers[index] >= 0) {
+                resolved[index] = 1;
+                flats.push(index);
             }
         }
     }
 
-    return rivers;
+    // Plats (lacs remplis compris) : parcours en largeur depuis leurs sorties, chaque cellule se déverse vers
+    // le voisin de même niveau qui l'a atteinte. Le remplissage garantit un chemin non montant vers un bord
+    while (!flats.empty()) {
+        int index = flats.front();
+        flats.pop();
+        const int x = index % width;
+        const int z = index / width;
+        for (int k = 0; k < 8; ++k) {
+            int nx = x + DX[k];
+            int nz = z + DZ[k];
+            if (nx < 0 || nz < 0 || nx >= width || nz >= depth) continue;
+            int neighbor = nx + nz * width;
+            if (resolved[neighbor] || filled[neighbor] != filled[index]) continue;
+            resolved[neighbor] = 1;
+            receivers[neighbor] = index;
+            flats.push(neighbor);
+        }
+    }
+
+    // Accumulation en ordre topologique (sources d'abord) : chaque cellule est complète avant d'être
+    // versée à l'aval
+    std::vector<uint8_t> donors(count, 0);
+    for (size_t index = 0; index < count; ++index) {
+        if (receivers[index] >= 0) ++donors[receivers[index]];
+    }
+    std::vector<int> sources;
+    for (size_t index = 0; index < count; ++index) {
+        if (donors[index] == 0) sources.push_back(static_cast<int>(index));
+    }
+    while (!sources.empty()) {
+        int index = sources.back();
+        sources.pop_back();
+        int receiver = receivers[index];
+        if (receiver < 0) continue;
+        flow[receiver] += flow[index];
+        if (--donors[receiver] == 0) sources.push_back(receiver);
+    }
+}
+
+float RiverGenerator::riverWidth(float flow) {
+    return std::clamp(std::sqrt(flow) * 0.25f, 2.0f, 10.0f);
+}
+
+float RiverGenerator::riverDepth(float flow) {
+    return std::clamp(std::sqrt(flow) * 0.075f, 0.5f, 3.0f);
 }
 
 void RiverGenerator::carveRivers(std::vector<std::vector<float>>& heightMap, const std::vector<std::vector<RiverPoint>>& rivers, float scale) {
@@ -112,29 +212,6 @@ void RiverGenerator::carveRivers(std::vector<std::vector<float>>& heightMap, con
     }
 }
 
-glm::vec2 RiverGenerator::findLowestNeighbor(const glm::vec2& pos, const TerrainGenerator& terrainGen, float stepSize) const {
-    float currentHeight = terrainGen.getHeight(pos.x, pos.y);
-    glm::vec2 lowestPos = pos;
-    float lowestHeight = currentHeight;
-
-    // Vérifie les 8 directions
-    for (int dx = -1; dx <= 1; ++dx) {
-        for (int dz = -1; dz <= 1; ++dz) {
-            if (dx == 0 && dz == 0) continue;
-
-            glm::vec2 testPos = pos + glm::vec2(dx * stepSize, dz * stepSize);
-            float testHeight = terrainGen.getHeight(testPos.x, testPos.y);
-
-            if (testHeight < lowestHeight) {
-                lowestHeight = testHeight;
-                lowestPos = testPos;
-            }
-        }
-    }
-
-    return lowestPos;
-}
-
 bool RiverGenerator::isValidPosition(const glm::vec2& pos, int width, int height, float scale) const {
     int x = static_cast<int>(pos.x / scale);
     int z = static_cast<int>(pos.y / scale);
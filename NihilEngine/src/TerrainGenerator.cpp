@@ -4,31 +4,64 @@
 namespace NihilEngine {
 
 TerrainGenerator::TerrainGenerator(unsigned int seed)
-    : noise(seed), baseHeight(0.0f), amplitude(10.0f), frequency(0.01f), octaves(4), persistence(0.5f) {}
+    : noise(seed), baseHeight(0.0f), amplitude(10.0f), frequency(0.01f), octaves(4), persistence(0.5f) {
+    rebuildLayers();
+}
+
+void TerrainGenerator::rebuildLayers() {
+    ++revision;
 
-float TerrainGenerator::getHeight(float x, float z) const {
-    // Génère du bruit fractal pour le terrain de base
-    float baseNoise = noise.fractal(x, z, octaves, persistence, frequency);
+    // Les octaves des montagnes (fréquences 2f, 4f...) coïncident avec ceux du relief : calculés une fois
+    layers = NoiseLayerSet({
+        {NoiseLayer::Type::Fractal, octaves, persistence, frequency, baseBasis},
+        {NoiseLayer::Type::Ridged, octaves / 2, persistence * 0.8f, frequency * 2.0f, mountainBasis}
+    });
+}
 
-    // Ajoute du bruit ridged pour les montagnes
-    float mountainNoise = noise.ridged(x, z, octaves / 2, persistence * 0.8f, frequency * 2.0f);
+float TerrainGenerator::getHeight(float x, float z, float sampleSpacing) const {
+    // Relief de base (fractal) et montagnes (ridged) en une passe
+    float values[LAYER_COUNT];
+    noise.evaluateLayers(layers, x, z, values, sampleSpacing);
 
     // Combine les bruits
-    float combinedNoise = baseNoise * 0.7f + mountainNoise * 0.3f;
+    float combinedNoise = values[BASE_LAYER] * 0.7f + values[MOUNTAIN_LAYER] * 0.3f;
 
     // Applique l'amplitude et la hauteur de base
     return baseHeight + combinedNoise * amplitude;
 }
 
+void TerrainGenerator::getHeightRegion(float* out, size_t stride, int width, int depth,
+                                       float originX, float originZ, float step, float sampleSpacing) const {
+    if (width <= 0 || depth <= 0) return;
+
+    // Mêmes opérations que getHeight, sur tout le rectangle (couches contiguës, puis combinaison ligne par ligne)
+    const size_t count = static_cast<size_t>(width) * depth;
+    // Tampon propre au thread (tuiles et chunks générés en boucle) : réalloué seulement pour une région plus grande
+    static thread_local std::vector<float> layerNoise;
+    if (layerNoise.size() < count * LAYER_COUNT) layerNoise.resize(count * LAYER_COUNT);
+    float* outs[LAYER_COUNT] = {layerNoise.data(), layerNoise.data() + count};
+    noise.evaluateLayersGrid(layers, outs, width, depth, originX, originZ, step, sampleSpacing);
+
+    for (int j = 0; j < depth; ++j) {
+        const float* baseRow = outs[BASE_LAYER] + static_cast<size_t>(j) * width;
+        const float* mountainRow = outs[MOUNTAIN_LAYER] + static_cast<size_t>(j) * width;
+        float* outRow = out + j * stride;
+        for (int i = 0; i < width; ++i) {
+            float combinedNoise = baseRow[i] * 0.7f + mountainRow[i] * 0.3f;
+            outRow[i] = baseHeight + combinedNoise * amplitude;
+        }
+    }
+}
+
 std::vector<std::vector<float>> TerrainGenerator::generateHeightMap(int width, int height, float scale) const {
-    std::vector<std::vector<float>> heightMap(height, std::vector<float>(width));
+    // Une seule passe sur la région, puis recopie dans les lignes
+    std::vector<float> heights(static_cast<size_t>(std::max(width, 0)) * std::max(height, 0));
+    getHeightRegion(heights.data(), static_cast<size_t>(width), width, height, 0.0f, 0.0f, scale);
 
+    std::vector<std::vector<float>> heightMap(height);
     for (int z = 0; z < height; ++z) {
-        for (int x = 0; x < width; ++x) {
-            float worldX = static_cast<float>(x) * scale;
-            float worldZ = static_cast<float>(z) * scale;
-            heightMap[z][x] = getHeight(worldX, worldZ);
-        }
+        auto row = heights.begin() + static_cast<size_t>(z) * width;
+        heightMap[z].assign(row, row + width);
     }
 
     return heightMap;
@@ -0,0 +1,144 @@
+#include <NihilEngine/TerrainTileCache.h>
+#include <NihilEngine/GridMath.h>
+#include <algorithm>
+
+namespace NihilEngine {
+
+TerrainTileCache::TerrainTileCache(const TerrainGenerator& terrainGen, const BiomeGenerator& biomeGen, size_t maxBytes)
+    : m_terrainGen(terrainGen), m_biomeGen(biomeGen),
+      m_maxTiles(std::max<size_t>(maxBytes / sizeof(Tile), 1)),
+      m_terrainRevision(terrainGen.getRevision()), m_biomeRevision(biomeGen.getRevision()) {}
+
+std::shared_ptr<const TerrainTileCache::Tile> TerrainTileCache::getTile(int tileX, int tileZ) {
+    uint64_t key = GridKey(tileX, tileZ);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        invalidateIfStale();
+
+        auto it = m_tiles.find(key);
+        if (it != m_tiles.end()) {
+            m_lru.splice(m_lru.begin(), m_lru, it->second.lruPosition);
+            ++m_cacheHits;
+            return it->second.tile;
+        }
+        ++m_cacheMisses;
+    }
+
+    // Génération hors verrou (déterministe : un calcul concurrent de la même tuile donne le même résultat)
+    unsigned int terrainRevision = m_terrainGen.getRevision();
+    unsigned int biomeRevision = m_biomeGen.getRevision();
+    std::shared_ptr<const Tile> tile = generateTile(tileX, tileZ);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    invalidateIfStale();
+    if (terrainRevision != m_terrainRevision || biomeRevision != m_biomeRevision) {
+        return tile; // Configuration changée pendant la génération : tuile servie une fois, pas conservée
+    }
+    auto inserted = m_tiles.emplace(key, Entry{tile, m_lru.end()});
+    if (inserted.second) {
+        m_lru.push_front(key);
+        inserted.first->second.lruPosition = m_lru.begin();
+        evictToCapacity();
+    }
+    return tile;
+}
+
+float TerrainTileCache::getHeight(int x, int z) {
+    int tileX = FloorDiv(x, TILE_SIZE);
+    int tileZ = FloorDiv(z, TILE_SIZE);
+    return getTile(tileX, tileZ)->heights[(x - tileX * TILE_SIZE) + (z - tileZ * TILE_SIZE) * TILE_SIZE];
+}
+
+BiomeType TerrainTileCache::getBiome(int x, int z) {
+    int tileX = FloorDiv(x, TILE_SIZE);
+    int tileZ = FloorDiv(z, TILE_SIZE);
+    return getTile(tileX, tileZ)->biomes[(x - tileX * TILE_SIZE) + (z - tileZ * TILE_SIZE) * TILE_SIZE];
+}
+
+void TerrainTileCache::getRegion(float* heights, size_t heightStride, BiomeType* biomes, size_t biomeStride,
+                                 int originX, int originZ, int width, int depth) {
+    if (width <= 0 || depth <= 0) return;
+
+    // Une copie par tuile recouverte, ligne par ligne
+    for (int tileZ = FloorDiv(originZ, TILE_SIZE); tileZ * TILE_SIZE < originZ + depth; ++tileZ) {
+        for (int tileX = FloorDiv(originX, TILE_SIZE); tileX * TILE_SIZE < originX + width; ++tileX) {
+            std::shared_ptr<const Tile> tile = getTile(tileX, tileZ);
+
+            int x0 = std::max(originX, tileX * TILE_SIZE);
+            int x1 = std::min(originX + width, (tileX + 1) * TILE_SIZE);
+            int z0 = std::max(originZ, tileZ * TILE_SIZE);
+            int z1 = std::min(originZ + depth, (tileZ + 1) * TILE_SIZE);
+
+            for (int z = z0; z < z1; ++z) {
+                size_t source = (x0 - tileX * TILE_SIZE) + static_cast<size_t>(z - tileZ * TILE_SIZE) * TILE_SIZE;
+                size_t row = static_cast<size_t>(z - originZ);
+                std::copy_n(tile->heights.data() + source, x1 - x0, heights + (x0 - originX) + row * heightStride);
+                if (biomes) {
+                    std::copy_n(tile->biomes.data() + source, x1 - x0, biomes + (x0 - originX) + row * biomeStride);
+                }
+            }
+        }
+    }
+}
+
+void TerrainTileCache::setMaxBytes(size_t maxBytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_maxTiles = std::max<size_t>(maxBytes / sizeof(Tile), 1);
+    evictToCapacity();
+}
+
+size_t TerrainTileCache::getMaxTiles() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_maxTiles;
+}
+
+size_t TerrainTileCache::getTileCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_tiles.size();
+}
+
+size_t TerrainTileCache::getCacheHits() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cacheHits;
+}
+
+size_t TerrainTileCache::getCacheMisses() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_cacheMisses;
+}
+
+void TerrainTileCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tiles.clear();
+    m_lru.clear();
+}
+
+std::shared_ptr<const TerrainTileCache::Tile> TerrainTileCache::generateTile(int tileX, int tileZ) const {
+    auto tile = std::make_shared<Tile>();
+    const float originX = static_cast<float>(tileX * TILE_SIZE);
+    const float originZ = static_cast<float>(tileZ * TILE_SIZE);
+    m_terrainGen.getHeightGrid(tile->heights.data(), TILE_SIZE, TILE_SIZE, originX, originZ);
+    m_biomeGen.getBiomeRegion(tile->biomes.data(), TILE_SIZE, TILE_SIZE, TILE_SIZE, originX, originZ, 1.0f,
+                              tile->heights.data(), TILE_SIZE);
+    return tile;
+}
+
+void TerrainTileCache::invalidateIfStale() {
+    unsigned int terrainRevision = m_terrainGen.getRevision();
+    unsigned int biomeRevision = m_biomeGen.getRevision();
+    if (terrainRevision != m_terrainRevision || biomeRevision != m_biomeRevision) {
+        m_tiles.clear();
+        m_lru.clear();
+        m_terrainRevision = terrainRevision;
+        m_biomeRevision = biomeRevision;
+    }
+}
+
+void TerrainTileCache::evictToCapacity() {
+    while (m_tiles.size() > m_maxTiles) {
+        m_tiles.erase(m_lru.back());
+        m_lru.pop_back();
+    }
+}
+
+}
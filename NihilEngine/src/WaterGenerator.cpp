@@ -1,6 +1,11 @@
 #include <NihilEngine/WaterGenerator.h>
+#include <NihilEngine/GridMath.h>
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <limits>
+#include <queue>
+#include <unordered_map>
 
 namespace NihilEngine {
 
@@ -32,8 +37,16 @@ void WaterGenerator::applyWaterLevels(std::vector<std::vector<float>>& heightMap
         }
     }
 
-    // Pour les lacs, on pourrait ajuster localement, mais pour simplifier,
-    // on laisse les rivières gérer les niveaux d'eau locaux
+    // Les lacs remplissent leur bassin jusqu'au niveau de débordement
+    for (const auto& water : waterBodies) {
+        if (water.type != WaterType::Lake) continue;
+        for (const glm::ivec2& cell : water.cells) {
+            if (cell.y >= 0 && cell.y < static_cast<int>(heightMap.size()) &&
+                cell.x >= 0 && cell.x < static_cast<int>(heightMap[cell.y].size())) {
+                heightMap[cell.y][cell.x] = std::max(heightMap[cell.y][cell.x], water.waterLevel);
+            }
+        }
+    }
 }
 
 bool WaterGenerator::isUnderwater(const glm::vec2& pos, const std::vector<WaterBody>& waterBodies) const {
@@ -65,102 +78,320 @@ std::vector<WaterBody> WaterGenerator::generateOceans(int width, int height, flo
 
 std::vector<WaterBody> WaterGenerator::generateLakes(int width, int height, float scale,
                                                     const std::vector<std::vector<float>>& heightMap) {
-    std::vector<WaterBody> lakes;
+    if (width <= 0 || height <= 0) return {};
 
-    // Trouve les dépressions potentielles pour les lacs
-    auto depressions = findDepressions(width, height, scale, heightMap);
+    // Carte recopiée à plat (lignes contiguës), puis remplie en une passe
+    std::vector<float> heights(static_cast<size_t>(width) * height);
+    for (int z = 0; z < height; ++z) {
+        std::copy_n(heightMap[z].begin(), width, heights.begin() + static_cast<size_t>(z) * width);
+    }
 
-    for (const auto& depression : depressions) {
-        // Calcule le niveau du lac
-        float lakeLevel = calculateLakeLevel(depression, 20.0f, heightMap, scale);
+    std::vector<float> filled;
+    fillDepressions(heights.data(), width, width, height, filled);
+    return findLakes(heights.data(), width, width, height, filled, 0, 0, scale);
+}
 
-        if (lakeLevel > 0.0f) { // Seulement si au-dessus du niveau de l'océan
-            WaterBody lake;
-            lake.type = WaterType::Lake;
-            lake.waterLevel = lakeLevel;
-            lake.color = glm::vec3(0.0f, 0.4f, 0.9f); // Bleu lac
+void WaterGenerator::fillDepressions(const float* heights, size_t stride, int width, int depth, std::vector<float>& filled,
+                                     std::vector<int>* receivers, std::vector<int>* order) {
+    const size_t count = static_cast<size_t>(width) * depth;
+    filled.assign(count, 0.0f);
+    if (receivers) receivers->assign(count, -1);
+    if (order) {
+        order->clear();
+        order->reserve(count);
+    }
+    if (count == 0) return;
+
+    // File de priorité (plus basse d'abord, égalités par indice : résultat déterministe)
+    using Cell = std::pair<float, int>;
+    std::priority_queue<Cell, std::vector<Cell>, std::greater<Cell>> open;
+    std::queue<int> pit; // Cellules noyées au niveau courant : pas besoin de la file de priorité
+    std::vector<uint8_t> closed(count, 0);
+
+    auto heightAt = [&](int index) {
+        return heights[(index % width) + (index / width) * stride];
+    };
+
+    // Les bords sont les exutoires
+    for (int z = 0; z < depth; ++z) {
+        for (int x = 0; x < width; ++x) {
+            if (x != 0 && z != 0 && x != width - 1 && z != depth - 1) continue;
+            int index = x + z * width;
+            filled[index] = heightAt(index);
+            closed[index] = 1;
+            open.emplace(filled[index], index);
+            if (order) order->push_back(index);
+        }
+    }
 
-            // Crée un contour circulaire simple
-            const int numPoints = 16;
-            for (int i = 0; i < numPoints; ++i) {
-                float angle = (2.0f * 3.14159f * i) / numPoints;
-                glm::vec2 point = depression + glm::vec2(std::cos(angle), std::sin(angle)) * 15.0f;
-                lake.outline.push_back(point);
-            }
+    static const int DX[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+    static const int DZ[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
+
+    while (!open.empty() || !pit.empty()) {
+        int index;
+        if (!pit.empty()) {
+            index = pit.front();
+            pit.pop();
+        } else {
+            index = open.top().second;
+            open.pop();
+        }
 
-            lakes.push_back(lake);
+        const int x = index % width;
+        const int z = index / width;
+        const float level = filled[index];
+        for (int k = 0; k < 8; ++k) {
+            int nx = x + DX[k];
+            int nz = z + DZ[k];
+            if (nx < 0 || nz < 0 || nx >= width || nz >= depth) continue;
+
+            int neighbor = nx + nz * width;
+            if (closed[neighbor]) continue;
+            closed[neighbor] = 1;
+            if (receivers) (*receivers)[neighbor] = index;
+            if (order) order->push_back(neighbor);
+
+            float h = heightAt(neighbor);
+            if (h <= level) {
+                filled[neighbor] = level; // Noyée : même niveau que la cellule qui s'y déverse
+                pit.push(neighbor);
+            } else {
+                filled[neighbor] = h;
+                open.emplace(h, neighbor);
+            }
         }
     }
-
-    return lakes;
 }
 
-std::vector<glm::vec2> WaterGenerator::findDepressions(int width, int height, float scale,
-                                                      const std::vector<std::vector<float>>& heightMap) {
-    std::vector<glm::vec2> depressions;
-
-    // Échantillonne des points pour trouver les dépressions
-    for (int z = 10; z < height - 10; z += 20) {
-        for (int x = 10; x < width - 10; x += 20) {
-            float centerHeight = heightMap[z][x];
-            bool isDepression = true;
-
-            // Vérifie si les voisins sont plus hauts
-            for (int dz = -5; dz <= 5 && isDepression; ++dz) {
-                for (int dx = -5; dx <= 5; ++dx) {
-                    if (dx == 0 && dz == 0) continue;
-
-                    int nx = x + dx;
-                    int nz = z + dz;
+void WaterGenerator::fillDepressionsTiled(const float* heights, size_t stride, int width, int depth, int tileSize,
+                                          std::vector<float>& filled) {
+    const size_t count = static_cast<size_t>(width) * depth;
+    filled.assign(count, 0.0f);
+    if (count == 0) return;
+    tileSize = std::max(tileSize, 1);
+
+    // Étiquette d'une cellule : bassin de la tuile par lequel le remplissage local l'a atteinte.
+    // OUTLET = germes du bord de la grille (les vrais exutoires) ; un germe de pourtour de tuile qui sort de la
+    // file sans avoir été atteint ouvre un nouveau bassin
+    const int32_t NO_LABEL = 0;
+    const int32_t OUTLET = 1;
+    std::vector<int32_t> labels(count, NO_LABEL);
+    std::vector<uint8_t> closed(count, 0);
+    int32_t labelCount = 2;
+
+    // Graphe de débordement : (bassin a, bassin b) -> plus bas niveau de passage entre eux
+    std::unordered_map<uint64_t, float> spill;
+    auto addSpill = [&](int32_t a, int32_t b, float level) {
+        if (a == b) return;
+        if (a > b) std::swap(a, b);
+        uint64_t key = (static_cast<uint64_t>(a) << 32) | static_cast<uint32_t>(b);
+        auto inserted = spill.emplace(key, level);
+        if (!inserted.second && level < inserted.first->second) inserted.first->second = level;
+    };
+
+    auto heightAt = [&](int index) {
+        return heights[(index % width) + (index / width) * stride];
+    };
+
+    static const int DX[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+    static const int DZ[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
+
+    // 1. Remplissage de chaque tuile depuis son propre pourtour (même Priority-Flood que fillDepressions)
+    using Cell = std::pair<float, int>;
+    std::priority_queue<Cell, std::vector<Cell>, std::greater<Cell>> open;
+    std::queue<int> pit;
+
+    for (int z0 = 0; z0 < depth; z0 += tileSize) {
+        for (int x0 = 0; x0 < width; x0 += tileSize) {
+            const int x1 = std::min(x0 + tileSize, width);
+            const int z1 = std::min(z0 + tileSize, depth);
+
+            for (int z = z0; z < z1; ++z) {
+                for (int x = x0; x < x1; ++x) {
+                    if (x != x0 && z != z0 && x != x1 - 1 && z != z1 - 1) continue;
+                    int index = x + z * width;
+                    filled[index] = heightAt(index);
+                    closed[index] = 1;
+                    if (x == 0 || z == 0 || x == width - 1 || z == depth - 1) labels[index] = OUTLET;
+                    open.emplace(filled[index], index);
+                }
+            }
 
-                    if (nx >= 0 && nx < width && nz >= 0 && nz < height) {
-                        if (heightMap[nz][nx] < centerHeight) {
-                            isDepression = false;
-                            break;
+            while (!open.empty() || !pit.empty()) {
+                int index;
+                if (!pit.empty()) {
+                    index = pit.front();
+                    pit.pop();
+                } else {
+                    index = open.top().second;
+                    open.pop();
+                }
+                if (labels[index] == NO_LABEL) labels[index] = labelCount++;
+
+                const int x = index % width;
+                const int z = index / width;
+                const float level = filled[index];
+                for (int k = 0; k < 8; ++k) {
+                    int nx = x + DX[k];
+                    int nz = z + DZ[k];
+                    if (nx < x0 || nz < z0 || nx >= x1 || nz >= z1) continue;
+
+                    int neighbor = nx + nz * width;
+                    if (closed[neighbor]) {
+                        if (labels[neighbor] == NO_LABEL) {
+                            // Germe encore en file, au moins aussi haut que level : atteint par ce bassin, comme
+                            // une cellule intérieure (même niveau, filled = hauteur) ; évite un bassin par germe
+                            labels[neighbor] = labels[index];
+                        } else {
+                            // Deux bassins se touchent : l'eau passe de l'un à l'autre au plus haut des deux niveaux
+                            addSpill(labels[index], labels[neighbor], std::max(level, filled[neighbor]));
                         }
+                        continue;
+                    }
+                    closed[neighbor] = 1;
+                    labels[neighbor] = labels[index];
+
+                    float h = heightAt(neighbor);
+                    if (h <= level) {
+                        filled[neighbor] = level;
+                        pit.push(neighbor);
+                    } else {
+                        filled[neighbor] = h;
+                        open.emplace(h, neighbor);
                     }
                 }
             }
+        }
+    }
+
+    // 2. Passages entre tuiles, entre cellules de pourtour (non remplies localement : filled = hauteur).
+    // Toute paire de voisins de tuiles différentes a sa cellule gauche sur une dernière colonne de tuile,
+    // ou sa cellule haute sur une dernière ligne
+    auto addCrossing = [&](int x, int z, int nx, int nz) {
+        if (nx < 0 || nz < 0 || nx >= width || nz >= depth) return;
+        int index = x + z * width;
+        int neighbor = nx + nz * width;
+        addSpill(labels[index], labels[neighbor], std::max(filled[index], filled[neighbor]));
+    };
+    for (int x = tileSize - 1; x < width - 1; x += tileSize) {
+        for (int z = 0; z < depth; ++z) {
+            for (int dz = -1; dz <= 1; ++dz) addCrossing(x, z, x + 1, z + dz);
+        }
+    }
+    for (int z = tileSize - 1; z < depth - 1; z += tileSize) {
+        for (int x = 0; x < width; ++x) {
+            for (int dx = -1; dx <= 1; ++dx) addCrossing(x, z, x + dx, z + 1);
+        }
+    }
+
+    // 3. Niveau de chaque bassin : minimax depuis l'exutoire sur le graphe (Dijkstra, max au lieu de somme)
+    std::vector<std::vector<std::pair<int32_t, float>>> edges(labelCount);
+    for (const auto& passage : spill) {
+        int32_t a = static_cast<int32_t>(passage.first >> 32);
+        int32_t b = static_cast<int32_t>(passage.first & 0xFFFFFFFFu);
+        edges[a].emplace_back(b, passage.second);
+        edges[b].emplace_back(a, passage.second);
+    }
 
-            if (isDepression && centerHeight > 1.0f) { // Pas trop près du niveau de l'océan
-                depressions.emplace_back(x * scale, z * scale);
+    std::vector<float> basinLevels(labelCount, std::numeric_limits<float>::infinity());
+    using Basin = std::pair<float, int32_t>;
+    std::priority_queue<Basin, std::vector<Basin>, std::greater<Basin>> basins;
+    basinLevels[OUTLET] = -std::numeric_limits<float>::infinity();
+    basins.emplace(basinLevels[OUTLET], OUTLET);
+    while (!basins.empty()) {
+        Basin basin = basins.top();
+        basins.pop();
+        if (basin.first > basinLevels[basin.second]) continue;
+        for (const auto& edge : edges[basin.second]) {
+            float level = std::max(basin.first, edge.second);
+            if (level < basinLevels[edge.first]) {
+                basinLevels[edge.first] = level;
+                basins.emplace(level, edge.first);
             }
         }
     }
 
-    return depressions;
+    // 4. Retour dans les tuiles : une cellule est noyée au moins jusqu'au niveau de son bassin
+    for (size_t index = 0; index < count; ++index) {
+        filled[index] = std::max(filled[index], basinLevels[labels[index]]);
+    }
 }
 
-float WaterGenerator::calculateLakeLevel(const glm::vec2& center, float radius,
-                                        const std::vector<std::vector<float>>& heightMap, float scale) {
-    int cx = static_cast<int>(center.x / scale);
-    int cz = static_cast<int>(center.y / scale);
-    int r = static_cast<int>(radius / scale);
-
-    float minHeight = std::numeric_limits<float>::max();
-    float maxHeight = std::numeric_limits<float>::min();
-
-    // Trouve les hauteurs dans le rayon
-    for (int dz = -r; dz <= r; ++dz) {
-        for (int dx = -r; dx <= r; ++dx) {
-            int nx = cx + dx;
-            int nz = cz + dz;
-
-            if (nx >= 0 && nx < static_cast<int>(heightMap[0].size()) &&
-                nz >= 0 && nz < static_cast<int>(heightMap.size())) {
-
-                float dist = std::sqrt(dx * dx + dz * dz);
-                if (dist <= r) {
-                    float h = heightMap[nz][nx];
-                    minHeight = std::min(minHeight, h);
-                    maxHeight = std::max(maxHeight, h);
+std::vector<WaterBody> WaterGenerator::findLakes(const float* heights, size_t stride, int width, int depth,
+                                                 const std::vector<float>& filled, int cellX, int cellZ, float scale,
+                                                 std::vector<glm::ivec2>* lowestCells) const {
+    std::vector<WaterBody> lakes;
+    if (lowestCells) lowestCells->clear();
+
+    auto heightAt = [&](int x, int z) { return heights[x + z * stride]; };
+    auto isFlooded = [&](int x, int z) { return filled[x + z * width] > heightAt(x, z); };
+
+    std::vector<uint8_t> visited(filled.size(), 0);
+    std::vector<glm::ivec2> stack;
+    std::vector<glm::ivec2> cells;
+
+    for (int startZ = 0; startZ < depth; ++startZ) {
+        for (int startX = 0; startX < width; ++startX) {
+            if (visited[startX + startZ * width] || !isFlooded(startX, startZ)) continue;
+
+            // Parcours de la composante (8-connexe, comme le remplissage)
+            cells.clear();
+            stack.assign(1, glm::ivec2(startX, startZ));
+            visited[startX + startZ * width] = 1;
+            glm::ivec2 lowest(startX, startZ);
+            bool touchesBorder = false;
+
+            while (!stack.empty()) {
+                glm::ivec2 cell = stack.back();
+                stack.pop_back();
+                cells.push_back(cell);
+
+                // Cellule la plus basse (égalités : plus petit z, puis x), indépendante de la zone analysée
+                float h = heightAt(cell.x, cell.y);
+                float lowestHeight = heightAt(lowest.x, lowest.y);
+                if (h < lowestHeight || (h == lowestHeight && (cell.y < lowest.y || (cell.y == lowest.y && cell.x < lowest.x)))) {
+                    lowest = cell;
+                }
+
+                for (int dz = -1; dz <= 1; ++dz) {
+                    for (int dx = -1; dx <= 1; ++dx) {
+                        int nx = cell.x + dx;
+                        int nz = cell.y + dz;
+                        // Voisin sur le bord : le bassin se déverse hors de la zone, niveau incertain
+                        if (nx <= 0 || nz <= 0 || nx >= width - 1 || nz >= depth - 1) touchesBorder = true;
+                        if (nx < 0 || nz < 0 || nx >= width || nz >= depth) continue;
+                        if (visited[nx + nz * width] || !isFlooded(nx, nz)) continue;
+                        visited[nx + nz * width] = 1;
+                        stack.emplace_back(nx, nz);
+                    }
+                }
+            }
+
+            float level = filled[lowest.x + lowest.y * width];
+            if (touchesBorder || level <= 0.0f) continue; // Seulement au-dessus du niveau de l'océan
+            if (level - heightAt(lowest.x, lowest.y) < MIN_LAKE_DEPTH) continue;
+
+            WaterBody lake;
+            lake.type = WaterType::Lake;
+            lake.waterLevel = level;
+            lake.color = glm::vec3(0.0f, 0.4f, 0.9f); // Bleu lac
+            lake.cells.reserve(cells.size());
+            for (const glm::ivec2& cell : cells) {
+                lake.cells.emplace_back(cellX + cell.x, cellZ + cell.y);
+
+                // Pourtour : au moins un voisin direct hors du lac
+                bool edge = !isFlooded(cell.x - 1, cell.y) || !isFlooded(cell.x + 1, cell.y) ||
+                            !isFlooded(cell.x, cell.y - 1) || !isFlooded(cell.x, cell.y + 1);
+                if (edge) {
+                    lake.outline.push_back(glm::vec2(cellX + cell.x, cellZ + cell.y) * scale);
                 }
             }
+            lakes.push_back(std::move(lake));
+            if (lowestCells) lowestCells->emplace_back(cellX + lowest.x, cellZ + lowest.y);
         }
     }
 
-    // Le niveau du lac est le minimum local, mais au moins 0.5 au-dessus du minimum
-    return std::max(minHeight + 0.5f, 0.5f);
+    return lakes;
 }
 
-}
\ No newline at end of file
+}
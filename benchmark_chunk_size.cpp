@@ -0,0 +1,354 @@
+// benchmark_chunk_size.cpp
+// Compare des formes de chunk (16³, 32³, 32x16x32, colonnes 16x256x16 actuelles) sur une même région :
+// temps de meshing, nombre d'appels de dessin (chunks non vides) et mémoire (voxels en sections palettisées
+// + sommets). Les formes sont meshées par un modèle du mesher glouton ; la forme actuelle l'est aussi par le
+// vrai chemin du jeu (Chunk::BuildMeshData). Le rapport vrai chemin / modèle mesuré sur cette forme recale
+// les temps du modèle : seuls les temps recalés sont affichés pour les autres formes.
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <NihilEngine/ProceduralGenerator.h>
+#include <MonJeu/Chunk.h>
+#include <MonJeu/ChunkDimensions.h>
+#include <MonJeu/Constants.h>
+#include <MonJeu/PalettedVoxelStorage.h>
+
+namespace {
+
+const int REGION_SIZE = 256;  // Côté de la région mesurée, en blocs (multiple de toutes les largeurs testées)
+const int WORLD_HEIGHT = 256;
+const int RUNS = 3;           // Meilleur temps retenu
+
+enum Block : uint8_t { Air, Grass, Dirt, Stone };
+
+/**
+ * @brief Hauteurs de la région, calculées une fois pour toutes les formes.
+ * Les voxels hors région suivent la même surface (bordure du dernier échantillon).
+ */
+class RegionHeights {
+public:
+    explicit RegionHeights(NihilEngine::TerrainGenerator& terrain) : m_Heights(REGION_SIZE * REGION_SIZE) {
+        for (int z = 0; z < REGION_SIZE; ++z) {
+            for (int x = 0; x < REGION_SIZE; ++x) {
+                float h = terrain.getHeight(static_cast<float>(x), static_cast<float>(z));
+                m_Heights[x + z * REGION_SIZE] = std::clamp(static_cast<int>(h), 1, WORLD_HEIGHT - 1);
+            }
+        }
+    }
+
+    uint8_t BlockAt(int x, int y, int z) const {
+        if (y < 0) return Stone;
+        if (y >= WORLD_HEIGHT) return Air;
+        int height = m_Heights[std::clamp(x, 0, REGION_SIZE - 1) + std::clamp(z, 0, REGION_SIZE - 1) * REGION_SIZE];
+        if (y > height) return Air;
+        if (y == height) return Grass;
+        return y >= height - 3 ? Dirt : Stone;
+    }
+
+private:
+    std::vector<int> m_Heights;
+};
+
+/**
+ * @brief Modèle de chunk dense de forme Dims, meshé par une copie simplifiée du balayage glouton de
+ * Chunk::BuildGreedyMesh : tranche par tranche, masque 2D des faces visibles, fusion des rectangles
+ * de même bloc. Sans sections, masques d'occupation ni ChunkMeshBuilder : ses temps comparent les
+ * formes entre elles, pas au jeu (voir RunChunkBenchmark).
+ */
+template <class Dims>
+class BenchChunk {
+public:
+    BenchChunk(int originX, int originY, int originZ, const RegionHeights& region)
+        : m_Origin{originX, originY, originZ}, m_Region(region), m_Blocks(Dims::VOLUME) {
+        for (int z = 0; z < Dims::SIZE_Z; ++z) {
+            for (int y = 0; y < Dims::SIZE_Y; ++y) {
+                for (int x = 0; x < Dims::SIZE_X; ++x) {
+                    m_Blocks[Dims::Index(x, y, z)] = region.BlockAt(originX + x, originY + y, originZ + z);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Ajoute 4 sommets par quad visible ; renvoie le nombre de quads.
+     */
+    size_t Mesh(std::vector<uint32_t>& vertices) const {
+        static constexpr std::array<int, 3> SIZES = {Dims::SIZE_X, Dims::SIZE_Y, Dims::SIZE_Z};
+        // Axe et sens de chaque face (+Z, -Z, -X, +X, +Y, -Y)
+        static constexpr int FACE_AXIS[6] = {2, 2, 0, 0, 1, 1};
+        static constexpr int FACE_DIR[6] = {1, -1, -1, 1, 1, -1};
+
+        size_t quadCount = 0;
+        std::vector<uint8_t> mask;
+        for (int face = 0; face < 6; ++face) {
+            const int axis = FACE_AXIS[face];
+            const int u = (axis + 1) % 3;
+            const int v = (axis + 2) % 3;
+            const int width = SIZES[u];
+            const int height = SIZES[v];
+            mask.assign(static_cast<size_t>(width) * height, Air);
+
+            for (int depth = 0; depth < SIZES[axis]; ++depth) {
+                int pos[3];
+                pos[axis] = depth;
+                for (int j = 0; j < height; ++j) {
+                    pos[v] = j;
+                    for (int i = 0; i < width; ++i) {
+                        pos[u] = i;
+                        uint8_t block = m_Blocks[Dims::Index(pos[0], pos[1], pos[2])];
+                        int neighbor[3] = {pos[0], pos[1], pos[2]};
+                        neighbor[axis] += FACE_DIR[face];
+                        mask[i + j * width] = (block != Air && !IsSolid(neighbor)) ? block : static_cast<uint8_t>(Air);
+                    }
+                }
+
+                for (int j = 0; j < height; ++j) {
+                    for (int i = 0; i < width; ) {
+                        uint8_t block = mask[i + j * width];
+                        if (block == Air) { ++i; continue; }
+
+                        int w = 1;
+                        while (i + w < width && mask[i + w + j * width] == block) ++w;
+                        int h = 1;
+                        for (; j + h < height; ++h) {
+                            bool rowMatches = true;
+                            for (int k = 0; k < w && rowMatches; ++k) rowMatches = mask[i + k + (j + h) * width] == block;
+                            if (!rowMatches) break;
+                        }
+                        for (int dj = 0; dj < h; ++dj) {
+                            std::fill_n(mask.begin() + i + (j + dj) * width, w, Air);
+                        }
+
+                        uint32_t corner = static_cast<uint32_t>(i | (j << 8) | (depth << 16) | (face << 25));
+                        vertices.insert(vertices.end(), {corner, corner + static_cast<uint32_t>(w),
+                                                         corner + static_cast<uint32_t>(w + (h << 8)), corner + static_cast<uint32_t>(h << 8)});
+                        ++quadCount;
+                        i += w;
+                    }
+                }
+            }
+        }
+        return quadCount;
+    }
+
+    bool IsEmpty() const {
+        return std::all_of(m_Blocks.begin(), m_Blocks.end(), [](uint8_t block) { return block == Air; });
+    }
+
+    /**
+     * @brief Mémoire des voxels stockés comme dans Chunk : pile de sections d'au plus SIZE_X blocs de haut,
+     * palette + indices empaquetés (PalettedVoxelStorage), sections vides non allouées.
+     */
+    size_t StorageBytes() const {
+        const int sectionHeight = std::min(Dims::SIZE_Y, Dims::SIZE_X);
+        size_t bytes = 0;
+        for (int baseY = 0; baseY < Dims::SIZE_Y; baseY += sectionHeight) {
+            MonJeu::PalettedVoxelStorage section(static_cast<size_t>(Dims::SIZE_X) * sectionHeight * Dims::SIZE_Z, Air);
+            bool empty = true;
+            size_t index = 0;
+            for (int y = baseY; y < baseY + sectionHeight; ++y) {
+                for (int z = 0; z < Dims::SIZE_Z; ++z) {
+                    for (int x = 0; x < Dims::SIZE_X; ++x, ++index) {
+                        uint8_t block = m_Blocks[Dims::Index(x, y, z)];
+                        if (block == Air) continue;
+                        section.Set(index, block);
+                        empty = false;
+                    }
+                }
+            }
+            if (empty) continue;
+            section.Compact();
+            bytes += section.GetMemoryUsage();
+        }
+        return bytes;
+    }
+
+private:
+    std::array<int, 3> m_Origin;
+    const RegionHeights& m_Region;
+    std::vector<uint8_t> m_Blocks;
+
+    bool IsSolid(const int local[3]) const {
+        if (Dims::Contains(local[0], local[1], local[2])) {
+            return m_Blocks[Dims::Index(local[0], local[1], local[2])] != Air;
+        }
+        return m_Region.BlockAt(m_Origin[0] + local[0], m_Origin[1] + local[1], m_Origin[2] + local[2]) != Air;
+    }
+};
+
+struct BenchResult {
+    int chunkCount = 0;
+    int drawCount = 0;       // Chunks avec au moins un quad : un appel de dessin chacun
+    size_t quadCount = 0;
+    size_t voxelBytes = 0;   // Sections palettisées (palette + indices empaquetés), sections vides non comptées
+    size_t vertexBytes = 0;
+    double meshMs = 0.0;
+};
+
+template <class Dims>
+BenchResult RunBenchmark(const RegionHeights& region) {
+    static_assert(REGION_SIZE % Dims::SIZE_X == 0 && REGION_SIZE % Dims::SIZE_Z == 0, "La région doit être pavée exactement");
+    static_assert(WORLD_HEIGHT % Dims::SIZE_Y == 0, "La hauteur doit être pavée exactement");
+
+    std::vector<BenchChunk<Dims>> chunks;
+    for (int z = 0; z < REGION_SIZE; z += Dims::SIZE_Z) {
+        for (int y = 0; y < WORLD_HEIGHT; y += Dims::SIZE_Y) {
+            for (int x = 0; x < REGION_SIZE; x += Dims::SIZE_X) {
+                chunks.emplace_back(x, y, z, region);
+            }
+        }
+    }
+
+    size_t voxelBytes = 0;
+    for (const BenchChunk<Dims>& chunk : chunks) {
+        if (!chunk.IsEmpty()) voxelBytes += chunk.StorageBytes();
+    }
+
+    BenchResult result;
+    result.meshMs = 1e30;
+
+    std::vector<uint32_t> vertices;
+    for (int run = 0; run < RUNS; ++run) {
+        BenchResult current;
+        auto start = std::chrono::steady_clock::now();
+        for (const BenchChunk<Dims>& chunk : chunks) {
+            vertices.clear();
+            size_t quads = chunk.Mesh(vertices);
+            current.quadCount += quads;
+            current.vertexBytes += vertices.size() * sizeof(uint32_t);
+            if (quads > 0) ++current.drawCount;
+        }
+        auto end = std::chrono::steady_clock::now();
+        current.meshMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+        if (current.meshMs < result.meshMs) result = current;
+    }
+    result.chunkCount = static_cast<int>(chunks.size());
+    result.voxelBytes = voxelBytes;
+    return result;
+}
+
+/**
+ * @brief Colonnes du jeu meshées par le vrai chemin : Chunk::BuildMeshData (sections, masques
+ * d'occupation, ChunkMeshBuilder), toutes les sections re-meshées à chaque passe. Une couronne de
+ * chunks voisins, non mesurée, cache les faces de bordure comme le fait RegionHeights pour le modèle.
+ */
+BenchResult RunChunkBenchmark(const RegionHeights& region) {
+    using MonJeu::Chunk;
+    static_assert(REGION_SIZE % Chunk::SIZE == 0 && WORLD_HEIGHT == Chunk::HEIGHT, "La région doit être pavée exactement");
+
+    const int chunksPerSide = REGION_SIZE / Chunk::SIZE;
+    const int side = chunksPerSide + 2;
+    std::vector<std::unique_ptr<Chunk>> chunks; // (x + 1) + (z + 1) * side
+    for (int z = -1; z <= chunksPerSide; ++z) {
+        for (int x = -1; x <= chunksPerSide; ++x) {
+            auto chunk = std::make_unique<Chunk>(x, z, MonJeu::Constants::BiomeType::Plains);
+            for (int localZ = 0; localZ < Chunk::SIZE; ++localZ) {
+                for (int localX = 0; localX < Chunk::SIZE; ++localX) {
+                    for (int y = 0; y < Chunk::HEIGHT; ++y) {
+                        uint8_t block = region.BlockAt(x * Chunk::SIZE + localX, y, z * Chunk::SIZE + localZ);
+                        if (block == Air) break; // Surface en colonne : rien au-dessus du premier air
+                        chunk->SetVoxel(localX, y, localZ, static_cast<MonJeu::BlockType>(block));
+                    }
+                }
+            }
+            chunk->CompactSections();
+            chunks.push_back(std::move(chunk));
+        }
+    }
+    auto chunkAt = [&](int x, int z) { return chunks[(x + 1) + (z + 1) * side].get(); };
+
+    BenchResult result;
+    result.meshMs = 1e30;
+    for (int run = 0; run < RUNS; ++run) {
+        BenchResult current;
+        auto start = std::chrono::steady_clock::now();
+        for (int z = 0; z < chunksPerSide; ++z) {
+            for (int x = 0; x < chunksPerSide; ++x) {
+                MonJeu::ChunkNeighbors neighbors{chunkAt(x + 1, z), chunkAt(x - 1, z), chunkAt(x, z + 1), chunkAt(x, z - 1)};
+                Chunk& chunk = *chunkAt(x, z);
+                chunk.MarkAllSectionsDirty();
+                MonJeu::ChunkMeshData data = chunk.BuildMeshData(neighbors, MonJeu::MeshingMode::Greedy);
+
+                size_t quads = data.vertices.size() / 4;
+                current.quadCount += quads;
+                current.vertexBytes += data.vertices.size() * sizeof(uint32_t);
+                if (quads > 0) ++current.drawCount;
+                MonJeu::ChunkMeshBuilder::Recycle(std::move(data.vertices));
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        current.meshMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+        if (current.meshMs < result.meshMs) result = current;
+    }
+
+    result.chunkCount = chunksPerSide * chunksPerSide;
+    for (int z = 0; z < chunksPerSide; ++z) {
+        for (int x = 0; x < chunksPerSide; ++x) {
+            for (int sectionY = 0; sectionY < Chunk::SECTION_COUNT; ++sectionY) {
+                const MonJeu::PalettedVoxelStorage* section = chunkAt(x, z)->GetSection(sectionY);
+                if (section) result.voxelBytes += section->GetMemoryUsage();
+            }
+        }
+    }
+    return result;
+}
+
+void PrintResult(const std::string& name, const BenchResult& result) {
+    // Colonne alignée en caractères affichés : les octets de continuation UTF-8 ne comptent pas
+    int continuationBytes = static_cast<int>(std::count_if(name.begin(), name.end(), [](char c) {
+        return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+    }));
+    std::cout << std::left << std::setw(20 + continuationBytes) << name << std::right
+              << std::setw(8) << result.chunkCount
+              << std::setw(8) << result.drawCount
+              << std::setw(10) << result.quadCount
+              << std::setw(12) << std::fixed << std::setprecision(1) << result.meshMs
+              << std::setw(12) << std::setprecision(3) << result.meshMs / result.chunkCount
+              << std::setw(12) << std::setprecision(1) << result.voxelBytes / (1024.0 * 1024.0)
+              << std::setw(12) << result.vertexBytes / (1024.0 * 1024.0) << std::endl;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Benchmark des tailles de chunk (région " << REGION_SIZE << "x" << WORLD_HEIGHT << "x" << REGION_SIZE << ")..." << std::endl;
+
+    // Même terrain que VoxelWorld
+    NihilEngine::ProceduralGenerator generator(12345);
+    generator.getTerrainGenerator().setBaseHeight(static_cast<float>(MonJeu::Constants::BASE_HEIGHT));
+    generator.getTerrainGenerator().setAmplitude(static_cast<float>(MonJeu::Constants::TERRAIN_AMPLITUDE));
+    RegionHeights region(generator.getTerrainGenerator());
+
+    std::cout << std::left << std::setw(20) << "Forme" << std::right
+              << std::setw(8) << "Chunks" << std::setw(8) << "Draws" << std::setw(10) << "Quads"
+              << std::setw(12) << "Mesh (ms)" << std::setw(12) << "ms/chunk"
+              << std::setw(12) << "Voxels(Mo)" << std::setw(12) << "Sommets(Mo)" << std::endl;
+
+    // Étalon : la forme actuelle par le modèle et par le vrai chemin. Les temps bruts du modèle ne sont pas
+    // comparables au jeu (pas de masques d'occupation ni de cache de sections) : ils sont recalés par ce rapport
+    BenchResult model = RunBenchmark<MonJeu::ChunkShape>(region);
+    BenchResult game = RunChunkBenchmark(region);
+    const double calibration = game.meshMs / model.meshMs;
+    auto calibrated = [calibration](BenchResult result) {
+        result.meshMs *= calibration;
+        return result;
+    };
+
+    PrintResult("16x16x16 (recalé)", calibrated(RunBenchmark<MonJeu::ChunkDimensions<16, 16, 16>>(region)));
+    PrintResult("32x32x32 (recalé)", calibrated(RunBenchmark<MonJeu::ChunkDimensions<32, 32, 32>>(region)));
+    PrintResult("32x16x32 (recalé)", calibrated(RunBenchmark<MonJeu::ChunkDimensions<32, 16, 32>>(region)));
+    PrintResult("16x256x16 (recalé)", calibrated(model));
+    PrintResult("16x256x16 (Chunk)", game);
+    std::cout << "Temps du modèle recalés par le rapport Chunk / modèle mesuré sur 16x256x16 : x"
+              << std::setprecision(3) << calibration << std::endl;
+
+    return 0;
+}
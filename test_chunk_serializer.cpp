@@ -0,0 +1,153 @@
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <MonJeu/ChunkSerializer.h>
+#include "test_harness.h"
+
+using MonJeu::BlockType;
+using MonJeu::Chunk;
+using MonJeu::ChunkSerializer;
+
+namespace {
+
+// En-tête commun aux versions : version, chunkX, chunkZ, biome
+const size_t HEADER_SIZE = sizeof(uint32_t) + sizeof(int32_t) * 2 + sizeof(uint8_t);
+
+bool SameVoxels(const Chunk& a, const Chunk& b) {
+    for (int y = 0; y < Chunk::HEIGHT; ++y) {
+        for (int z = 0; z < Chunk::SIZE; ++z) {
+            for (int x = 0; x < Chunk::SIZE; ++x) {
+                if (a.GetVoxel(x, y, z).type != b.GetVoxel(x, y, z).type) return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::unique_ptr<Chunk> RoundTrip(const Chunk& chunk) {
+    std::vector<uint8_t> bytes = ChunkSerializer::SerializeChunk(chunk);
+    return ChunkSerializer::CreateChunkFromSerializedData(ChunkSerializer::DeserializeChunk(bytes));
+}
+
+// Vrai si la lecture complète (en-tête puis sections) rejette les données
+bool IsRejected(const std::vector<uint8_t>& bytes) {
+    try {
+        ChunkSerializer::CreateChunkFromSerializedData(ChunkSerializer::DeserializeChunk(bytes));
+    } catch (const std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+
+void TestEmptyChunk() {
+    Chunk chunk(3, -7, MonJeu::Constants::BiomeType::Plains);
+    std::vector<uint8_t> bytes = ChunkSerializer::SerializeChunk(chunk);
+    Check(bytes.size() == HEADER_SIZE + 1 + Chunk::SECTION_COUNT, "colonne vide : un octet par section");
+
+    std::unique_ptr<Chunk> loaded = RoundTrip(chunk);
+    Check(loaded->GetChunkX() == 3 && loaded->GetChunkZ() == -7, "colonne vide : coordonnées");
+    for (int sectionY = 0; sectionY < Chunk::SECTION_COUNT; ++sectionY) {
+        Check(loaded->GetSection(sectionY) == nullptr, "colonne vide : sections non allouées");
+    }
+}
+
+void TestMixedSections() {
+    // Section 0 homogène (pierre), section 1 pleine (motif), section 2 vide, section 3 homogène (terre)
+    Chunk chunk(-1, 2, MonJeu::Constants::BiomeType::Plains);
+    chunk.FillSection(0, BlockType::Stone);
+    for (int y = Chunk::SIZE; y < 2 * Chunk::SIZE; ++y) {
+        for (int z = 0; z < Chunk::SIZE; ++z) {
+            for (int x = 0; x < Chunk::SIZE; ++x) {
+                chunk.SetVoxel(x, y, z, static_cast<BlockType>((x + 2 * y + 3 * z) % 4));
+            }
+        }
+    }
+    chunk.FillSection(3, BlockType::Dirt);
+
+    std::unique_ptr<Chunk> loaded = RoundTrip(chunk);
+    Check(SameVoxels(chunk, *loaded), "sections mixtes : voxels identiques");
+    Check(loaded->GetSection(0) && loaded->GetSection(0)->IsUniform(), "section homogène relue homogène");
+    Check(loaded->GetSection(1) && !loaded->GetSection(1)->IsUniform(), "section pleine relue pleine");
+    Check(loaded->GetSection(2) == nullptr, "section vide relue vide");
+    Check(loaded->GetSection(3) && loaded->GetSection(3)->Get(0) == static_cast<uint8_t>(BlockType::Dirt),
+          "section homogène : type conservé");
+}
+
+void TestVersion1() {
+    // Ancien format écrit à la main : une section 16³, (type, active) par voxel, ordre y, z, x
+    std::vector<uint8_t> bytes(HEADER_SIZE + Chunk::SIZE * Chunk::SIZE * Chunk::SIZE * 2);
+    uint32_t version = 1;
+    int32_t chunkX = 5;
+    int32_t chunkZ = 6;
+    std::memcpy(bytes.data(), &version, sizeof(version));
+    std::memcpy(bytes.data() + 4, &chunkX, sizeof(chunkX));
+    std::memcpy(bytes.data() + 8, &chunkZ, sizeof(chunkZ));
+    bytes[12] = static_cast<uint8_t>(MonJeu::Constants::BiomeType::Plains);
+
+    size_t offset = HEADER_SIZE;
+    for (int y = 0; y < Chunk::SIZE; ++y) {
+        for (int z = 0; z < Chunk::SIZE; ++z) {
+            for (int x = 0; x < Chunk::SIZE; ++x) {
+                bytes[offset++] = static_cast<uint8_t>(BlockType::Stone);
+                bytes[offset++] = (y < 8 && x != 4) ? 1 : 0; // Inactif : air malgré son type
+            }
+        }
+    }
+
+    ChunkSerializer::SerializedChunk data = ChunkSerializer::DeserializeChunk(bytes);
+    Check(data.version == 1 && data.chunkX == 5 && data.chunkZ == 6, "v1 : en-tête");
+    std::unique_ptr<Chunk> loaded = ChunkSerializer::CreateChunkFromSerializedData(data);
+
+    bool matches = true;
+    for (int y = 0; y < Chunk::HEIGHT; ++y) {
+        for (int z = 0; z < Chunk::SIZE; ++z) {
+            for (int x = 0; x < Chunk::SIZE; ++x) {
+                BlockType expected = (y < 8 && x != 4) ? BlockType::Stone : BlockType::Air;
+                matches = matches && loaded->GetVoxel(x, y, z).type == expected;
+            }
+        }
+    }
+    Check(matches, "v1 : voxels relus (inactif = air, rien au-dessus de la première section)");
+
+    bytes.pop_back();
+    Check(IsRejected(bytes), "v1 : taille invalide rejetée");
+}
+
+void TestCorruptedVersion2() {
+    Chunk chunk(0, 0, MonJeu::Constants::BiomeType::Plains);
+    chunk.FillSection(0, BlockType::Stone);
+    chunk.SetVoxel(1, 2, 3, BlockType::Grass); // Section 0 pleine
+    const std::vector<uint8_t> bytes = ChunkSerializer::SerializeChunk(chunk);
+
+    // Troncature : sans nombre de sections, au milieu des voxels, dernier octet manquant
+    for (size_t size : {HEADER_SIZE, HEADER_SIZE + 2, bytes.size() / 2, bytes.size() - 1}) {
+        Check(IsRejected(std::vector<uint8_t>(bytes.begin(), bytes.begin() + size)), "v2 tronquée rejetée");
+    }
+
+    std::vector<uint8_t> badTag = bytes;
+    badTag[HEADER_SIZE + 1] = 7; // Tag de la première section
+    Check(IsRejected(badTag), "v2 : tag de section invalide rejeté");
+
+    std::vector<uint8_t> tooManySections = bytes;
+    tooManySections[HEADER_SIZE] = static_cast<uint8_t>(Chunk::SECTION_COUNT + 1);
+    Check(IsRejected(tooManySections), "v2 : trop de sections rejeté");
+
+    std::vector<uint8_t> badVersion = bytes;
+    badVersion[0] = 9;
+    Check(IsRejected(badVersion), "version inconnue rejetée");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Test de la sérialisation des chunks..." << std::endl;
+
+    TestEmptyChunk();
+    TestMixedSections();
+    TestVersion1();
+    TestCorruptedVersion2();
+
+    return FinishTests();
+}
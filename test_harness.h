@@ -0,0 +1,23 @@
+#pragma once
+
+#include <iostream>
+
+// Harnais commun des exécutables de test : Check compte les échecs, FinishTests en fait le code de sortie (ctest)
+
+inline int g_Failures = 0;
+
+inline void Check(bool condition, const char* message) {
+    if (!condition) {
+        std::cout << "ECHEC : " << message << std::endl;
+        ++g_Failures;
+    }
+}
+
+inline int FinishTests() {
+    if (g_Failures > 0) {
+        std::cout << g_Failures << " échec(s)" << std::endl;
+        return 1;
+    }
+    std::cout << "Tous les tests sont passés." << std::endl;
+    return 0;
+}
@@ -0,0 +1,369 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+#include <NihilEngine/GridMath.h>
+#include <NihilEngine/ProceduralGenerator.h>
+#include "test_harness.h"
+
+using NihilEngine::HydrologyCache;
+using NihilEngine::TerrainTileCache;
+using NihilEngine::WaterBody;
+using NihilEngine::WaterGenerator;
+using NihilEngine::WaterType;
+
+namespace {
+
+// Cellules d'un lac triées : identifie un lac indépendamment de l'ordre de parcours
+using CellList = std::vector<std::pair<int, int>>;
+
+CellList SortedCells(const WaterBody& lake, int offsetX = 0, int offsetZ = 0) {
+    CellList cells;
+    cells.reserve(lake.cells.size());
+    for (const glm::ivec2& cell : lake.cells) cells.emplace_back(cell.x + offsetX, cell.y + offsetZ);
+    std::sort(cells.begin(), cells.end());
+    return cells;
+}
+
+// Référence naïve : niveau = minimax, sur les chemins 8-connexes vers un bord, de la hauteur maximale
+// rencontrée (relaxation jusqu'au point fixe)
+std::vector<float> ReferenceFill(const std::vector<float>& heights, size_t stride, int width, int depth) {
+    std::vector<float> filled(static_cast<size_t>(width) * depth, std::numeric_limits<float>::infinity());
+    for (int z = 0; z < depth; ++z) {
+        for (int x = 0; x < width; ++x) {
+            if (x == 0 || z == 0 || x == width - 1 || z == depth - 1) filled[x + z * width] = heights[x + z * stride];
+        }
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int z = 1; z < depth - 1; ++z) {
+            for (int x = 1; x < width - 1; ++x) {
+                float lowestNeighbour = std::numeric_limits<float>::infinity();
+                for (int dz = -1; dz <= 1; ++dz) {
+                    for (int dx = -1; dx <= 1; ++dx) {
+                        if (dx != 0 || dz != 0) lowestNeighbour = std::min(lowestNeighbour, filled[(x + dx) + (z + dz) * width]);
+                    }
+                }
+                float level = std::max(heights[x + z * stride], lowestNeighbour);
+                if (level < filled[x + z * width]) {
+                    filled[x + z * width] = level;
+                    changed = true;
+                }
+            }
+        }
+    }
+    return filled;
+}
+
+void TestFillDepressions() {
+    std::mt19937 rng(1234);
+    bool fillMatches = true;
+    bool flowValid = true;
+
+    for (int trial = 0; trial < 500; ++trial) {
+        int width = 1 + static_cast<int>(rng() % 12);
+        int depth = 1 + static_cast<int>(rng() % 12);
+        // Peu de niveaux distincts : plats et égalités fréquents (file « pit » du Priority-Flood)
+        int levels = 2 + static_cast<int>(rng() % 8);
+        size_t stride = width + rng() % 3;
+
+        // Colonnes hors largeur (stride) à une valeur aberrante : ne doivent jamais être lues
+        std::vector<float> heights(stride * depth, 1000.0f);
+        for (int z = 0; z < depth; ++z) {
+            for (int x = 0; x < width; ++x) heights[x + z * stride] = static_cast<float>(rng() % levels) * 0.5f;
+        }
+
+        std::vector<float> filled;
+        std::vector<int> receivers;
+        std::vector<int> order;
+        WaterGenerator::fillDepressions(heights.data(), stride, width, depth, filled, &receivers, &order);
+        fillMatches = fillMatches && filled == ReferenceFill(heights, stride, width, depth);
+
+        // Écoulement : chaque cellule intérieure a pour receveur un voisin atteint avant elle, pas plus haut
+        const size_t count = static_cast<size_t>(width) * depth;
+        std::vector<int> rank(count, -1);
+        for (size_t i = 0; i < order.size(); ++i) rank[order[i]] = static_cast<int>(i);
+        flowValid = flowValid && order.size() == count;
+        for (int index = 0; index < static_cast<int>(count) && flowValid; ++index) {
+            int x = index % width;
+            int z = index / width;
+            bool border = x == 0 || z == 0 || x == width - 1 || z == depth - 1;
+            int receiver = receivers[index];
+            if (border) {
+                flowValid = receiver == -1;
+                continue;
+            }
+            int rx = receiver % width;
+            int rz = receiver / width;
+            flowValid = receiver >= 0 && std::abs(rx - x) <= 1 && std::abs(rz - z) <= 1 &&
+                        rank[receiver] >= 0 && rank[receiver] < rank[index] && filled[receiver] <= filled[index];
+        }
+    }
+
+    Check(fillMatches, "remplissage identique au minimax de référence");
+    Check(flowValid, "receveurs : voisins atteints avant, non plus hauts");
+}
+
+void TestTiledFill() {
+    std::mt19937 rng(5678);
+    bool matches = true;
+
+    // Tuiles de 1 à 7 cellules, dimensions quelconques (tuiles partielles aux bords), relief lisse ou en plateaux
+    for (int trial = 0; trial < 2000; ++trial) {
+        int width = 1 + static_cast<int>(rng() % 24);
+        int depth = 1 + static_cast<int>(rng() % 24);
+        int tileSize = 1 + static_cast<int>(rng() % 7);
+        size_t stride = width + rng() % 3;
+
+        std::vector<float> heights(stride * depth, 1000.0f);
+        for (int z = 0; z < depth; ++z) {
+            for (int x = 0; x < width; ++x) {
+                heights[x + z * stride] = (trial % 2) ? static_cast<float>(rng() % 6) * 0.5f
+                                                      : static_cast<float>(rng() % 10000) * 0.01f;
+            }
+        }
+
+        std::vector<float> expected;
+        std::vector<float> filled;
+        WaterGenerator::fillDepressions(heights.data(), stride, width, depth, expected);
+        WaterGenerator::fillDepressionsTiled(heights.data(), stride, width, depth, tileSize, filled);
+        matches = matches && filled == expected;
+    }
+    Check(matches, "remplissage par tuiles identique au remplissage d'un seul tenant");
+}
+
+void TestTileLakes() {
+    NihilEngine::ProceduralGenerator generator(12345);
+    TerrainTileCache& tiles = generator.getTileCache();
+    HydrologyCache& hydrology = generator.getHydrologyCache();
+    WaterGenerator& water = generator.getWaterGenerator();
+
+    // Toutes les tuiles du domaine (-1, -1), plus la première colonne du domaine (0, -1) : coutures de tuiles
+    // dans le domaine, et bord entre deux domaines
+    const int tileSize = TerrainTileCache::TILE_SIZE;
+    const int domainTiles = HydrologyCache::DOMAIN_TILES;
+    const int firstTile = -domainTiles;
+    const int columns = domainTiles + 1;
+
+    std::vector<std::vector<WaterBody>> tileLakes(columns * domainTiles);
+    for (int j = 0; j < domainTiles; ++j) {
+        for (int i = 0; i < columns; ++i) {
+            tileLakes[i + j * columns] = hydrology.getTileLakes(firstTile + i, firstTile + j);
+        }
+    }
+
+    // Aucune cellule produite par deux tuiles (doublon ou lacs incompatibles de part et d'autre d'une couture)
+    std::map<std::pair<int, int>, int> coverage;
+    bool disjoint = true;
+    for (const auto& lakes : tileLakes) {
+        for (const WaterBody& lake : lakes) {
+            for (const glm::ivec2& cell : lake.cells) disjoint = disjoint && ++coverage[{cell.x, cell.y}] == 1;
+        }
+    }
+    Check(disjoint, "tuiles : aucune cellule de lac produite deux fois");
+
+    // Lac traversant l'arête commune de deux tuiles voisines : produit par exactement l'une des deux
+    int crossingLakes = 0;
+    bool producedOnce = true;
+    for (int j = 0; j < domainTiles; ++j) {
+        for (int i = 0; i < columns; ++i) {
+            for (int axis = 0; axis < 2; ++axis) {
+                int ni = i + (axis == 0 ? 1 : 0);
+                int nj = j + (axis == 1 ? 1 : 0);
+                if (ni >= columns || nj >= domainTiles) continue;
+
+                // Arête : première colonne (axe X) ou ligne (axe Z) de la tuile voisine
+                const int edge = (firstTile + (axis == 0 ? ni : nj)) * tileSize;
+                std::map<CellList, int> producers;
+                for (const auto* lakes : {&tileLakes[i + j * columns], &tileLakes[ni + nj * columns]}) {
+                    for (const WaterBody& lake : *lakes) {
+                        CellList cells = SortedCells(lake);
+                        bool before = false;
+                        bool after = false;
+                        for (const auto& cell : cells) ((axis == 0 ? cell.first : cell.second) < edge ? before : after) = true;
+                        if (before && after) ++producers[cells];
+                    }
+                }
+                for (const auto& producer : producers) {
+                    ++crossingLakes;
+                    producedOnce = producedOnce && producer.second == 1;
+                }
+            }
+        }
+    }
+    Check(crossingLakes > 0, "tuiles : au moins un lac traverse une arête (test significatif)");
+    Check(producedOnce, "tuiles : lac traversant une arête produit par une seule des deux tuiles");
+
+    // Fenêtre bien plus large qu'une tuile : les tuiles du domaine donnent exactement les lacs d'une carte
+    // du domaine entier (un seul remplissage), y compris ceux qui s'étendent sur plusieurs tuiles
+    const int size = HydrologyCache::DOMAIN_SIZE;
+    const int originX = firstTile * tileSize;
+    const int originZ = firstTile * tileSize;
+    std::vector<std::vector<float>> heightMap(size, std::vector<float>(size));
+    for (int z = 0; z < size; ++z) tiles.getRegion(heightMap[z].data(), size, nullptr, 0, originX, originZ + z, size, 1);
+
+    std::map<CellList, float> expected;
+    for (const WaterBody& lake : water.generateWaterBodies(size, size, 1.0f, heightMap)) {
+        if (lake.type == WaterType::Lake) expected[SortedCells(lake, originX, originZ)] = lake.waterLevel;
+    }
+
+    std::map<CellList, float> produced;
+    int multiTileLakes = 0;
+    for (int j = 0; j < domainTiles; ++j) {
+        for (int i = 0; i < domainTiles; ++i) {
+            for (const WaterBody& lake : tileLakes[i + j * columns]) {
+                CellList cells = SortedCells(lake);
+                int spanX = NihilEngine::FloorDiv(cells.back().first, tileSize) - NihilEngine::FloorDiv(cells.front().first, tileSize);
+                if (spanX >= 2) ++multiTileLakes;
+                produced[std::move(cells)] = lake.waterLevel;
+            }
+        }
+    }
+    Check(multiTileLakes > 0, "domaine : au moins un lac sur trois tuiles ou plus (test significatif)");
+    Check(produced == expected, "domaine : mêmes lacs que le remplissage du domaine entier");
+
+    // Fenêtre plus large que le domaine (marge de 512 blocs) : approximation locale, les niveaux ne peuvent que
+    // monter quand la fenêtre grandit. Chaque cellule de lac des tuiles est inondée dans la grande fenêtre, à un
+    // niveau au moins égal (aucun lac fictif dû au bord du domaine, seulement des niveaux sous-estimés)
+    const int margin = 512;
+    const int wideSize = size + 2 * margin;
+    const int wideX = originX - margin;
+    const int wideZ = originZ - margin;
+    std::vector<float> wideHeights(static_cast<size_t>(wideSize) * wideSize);
+    tiles.getRegion(wideHeights.data(), wideSize, nullptr, 0, wideX, wideZ, wideSize, wideSize);
+    std::vector<float> wideFilled;
+    WaterGenerator::fillDepressions(wideHeights.data(), wideSize, wideSize, wideSize, wideFilled);
+
+    bool lowerBound = true;
+    for (int j = 0; j < domainTiles; ++j) {
+        for (int i = 0; i < domainTiles; ++i) {
+            for (const WaterBody& lake : tileLakes[i + j * columns]) {
+                for (const glm::ivec2& cell : lake.cells) {
+                    size_t index = static_cast<size_t>(cell.x - wideX) + static_cast<size_t>(cell.y - wideZ) * wideSize;
+                    lowerBound = lowerBound && wideFilled[index] > wideHeights[index] && wideFilled[index] >= lake.waterLevel;
+                }
+            }
+        }
+    }
+    Check(lowerBound, "fenêtre large : cellules de lac inondées, niveaux jamais surestimés");
+}
+
+void TestFlowAccumulation() {
+    std::mt19937 rng(9012);
+    bool receiversValid = true;
+    bool flowMatches = true;
+
+    for (int trial = 0; trial < 500; ++trial) {
+        int width = 1 + static_cast<int>(rng() % 16);
+        int depth = 1 + static_cast<int>(rng() % 16);
+        int levels = 2 + static_cast<int>(rng() % 8);
+        size_t stride = width + rng() % 3;
+
+        std::vector<float> heights(stride * depth, 1000.0f);
+        for (int z = 0; z < depth; ++z) {
+            for (int x = 0; x < width; ++x) heights[x + z * stride] = static_cast<float>(rng() % levels) * 0.5f;
+        }
+
+        std::vector<float> filled;
+        std::vector<int> receivers;
+        std::vector<float> flow;
+        WaterGenerator::fillDepressions(heights.data(), stride, width, depth, filled);
+        NihilEngine::RiverGenerator::computeFlow(heights.data(), stride, width, depth, receivers, flow);
+
+        // Référence naïve : chaque cellule suit ses receveurs jusqu'au bord et compte une fois pour chaque
+        // cellule traversée (au plus count pas : au-delà, le réseau a un cycle)
+        const int count = width * depth;
+        std::vector<float> expected(count, 0.0f);
+        for (int index = 0; index < count && receiversValid; ++index) {
+            int x = index % width;
+            int z = index / width;
+            bool border = x == 0 || z == 0 || x == width - 1 || z == depth - 1;
+            int receiver = receivers[index];
+            if (border || receiver < 0) {
+                receiversValid = border == (receiver < 0);
+            } else {
+                receiversValid = std::abs(receiver % width - x) <= 1 && std::abs(receiver / width - z) <= 1 &&
+                                 receiver != index && filled[receiver] <= filled[index];
+            }
+
+            int current = index;
+            for (int steps = 0; current >= 0 && steps <= count; ++steps) {
+                expected[current] += 1.0f;
+                current = receivers[current];
+            }
+            receiversValid = receiversValid && current < 0;
+        }
+        flowMatches = flowMatches && flow == expected;
+    }
+    Check(receiversValid, "écoulement : receveurs voisins, non plus hauts, sans cycle");
+    Check(flowMatches, "écoulement : débit identique au parcours naïf des chemins");
+}
+
+void TestTileRivers() {
+    NihilEngine::ProceduralGenerator generator(12345);
+    TerrainTileCache& tiles = generator.getTileCache();
+    HydrologyCache& hydrology = generator.getHydrologyCache();
+
+    // Domaine (-1, -1) : débit d'un seul tenant sur le domaine entier comme référence
+    const int tileSize = TerrainTileCache::TILE_SIZE;
+    const int domainTiles = HydrologyCache::DOMAIN_TILES;
+    const int size = HydrologyCache::DOMAIN_SIZE;
+    const int originX = -size;
+    const int originZ = -size;
+    std::vector<float> heights(static_cast<size_t>(size) * size);
+    tiles.getRegion(heights.data(), size, nullptr, 0, originX, originZ, size, size);
+    std::vector<int> receivers;
+    std::vector<float> flow;
+    NihilEngine::RiverGenerator::computeFlow(heights.data(), size, size, size, receivers, flow);
+
+    std::vector<NihilEngine::RiverTile> rivers;
+    for (int j = 0; j < domainTiles; ++j) {
+        for (int i = 0; i < domainTiles; ++i) rivers.push_back(hydrology.getTileRivers(-domainTiles + i, -domainTiles + j));
+    }
+    auto riverAt = [&](int index) -> const NihilEngine::RiverTile& {
+        return rivers[(index % size) / tileSize + ((index / size) / tileSize) * domainTiles];
+    };
+
+    bool matches = true;
+    bool continuous = true;
+    int crossings = 0;
+    for (int index = 0; index < size * size; ++index) {
+        const int x = originX + index % size;
+        const int z = originZ + index / size;
+        bool river = flow[index] >= NihilEngine::RiverGenerator::MIN_RIVER_FLOW && heights[index] >= 0.0f;
+        float width = river ? NihilEngine::RiverGenerator::riverWidth(flow[index]) : 0.0f;
+        matches = matches && riverAt(index).getWidth(x, z) == width;
+
+        // Couture : une rivière qui se déverse dans une autre tuile s'y prolonge (ou atteint l'océan)
+        int receiver = receivers[index];
+        if (!river || receiver < 0 || &riverAt(receiver) == &riverAt(index)) continue;
+        ++crossings;
+        continuous = continuous && (heights[receiver] < 0.0f ||
+                                    riverAt(receiver).isRiver(originX + receiver % size, originZ + receiver / size));
+    }
+    Check(matches, "rivières des tuiles identiques au débit du domaine entier");
+    Check(crossings > 0, "rivières : au moins une traverse une couture (test significatif)");
+    Check(continuous, "rivières : continues à travers les coutures de tuiles");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Test de l'hydrologie (Priority-Flood, remplissage par tuiles, lacs et rivières des domaines)..." << std::endl;
+
+    TestFillDepressions();
+    TestTiledFill();
+    TestTileLakes();
+    TestFlowAccumulation();
+    TestTileRivers();
+
+    return FinishTests();
+}